@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 
 #include <Geode/loader/Dispatch.hpp>
@@ -121,6 +122,8 @@ namespace NIDExtrasManager
 	bool isDirty();
 	void init(int);
 	void save();
+	// incremented every time the extras of `nid` change, used to invalidate caches
+	std::uint32_t getGeneration(NID nid);
 
 	void reset();
 #endif // !SPAGHETTDEV_NAMED_EDITOR_GROUPS_EXPORTING
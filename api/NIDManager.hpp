@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 
 #include <Geode/loader/Dispatch.hpp>
 #include <Geode/loader/Loader.hpp>
@@ -63,6 +66,20 @@ namespace NIDManager
 	std::string dumpNamedIDs();
 	geode::Result<> importNamedIDs(const std::string& str, bool setDirty = false);
 	std::unordered_map<std::string, short, geode::utils::StringHash, std::equal_to<>>& getMutNamedIDs(NID nid);
+	// saveNamedID for many IDs at once, with a single scan for the names they replace and a single generation bump.
+	// invalid entries are skipped, the rest are still saved
+	geode::Result<> saveNamedIDs(NID nid, std::span<const std::pair<std::string, short>> namedIDs);
+
+	struct SortedNamedID
+	{
+		// view into the Named IDs container, valid (like the returned span) until `getGeneration(nid)` changes
+		std::string_view name;
+		short id;
+	};
+	// the Named IDs of `nid` sorted by ID, rebuilt on first use after they change
+	std::span<const SortedNamedID> getSortedNamedIDs(NID nid);
+	// incremented every time the Named IDs of `nid` change, used to invalidate caches
+	std::uint32_t getGeneration(NID nid);
 
 	void reset();
 #endif // !SPAGHETTDEV_NAMED_EDITOR_GROUPS_EXPORTING
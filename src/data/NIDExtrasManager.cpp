@@ -9,6 +9,7 @@
 
 #include <types/NamedIDExtras.hpp>
 
+#include <array>
 #include <string_view>
 #include <filesystem>
 #include <fstream>
@@ -16,6 +17,8 @@
 #include "events/NewNamedIDExtrasEvent.hpp"
 #include "events/RemovedNamedIDExtrasEvent.hpp"
 
+#include "DescriptionIndex.hpp"
+
 #include "globals.hpp"
 
 #define LEVEL_ID_API_CHECK()                 \
@@ -31,6 +34,7 @@ static NamedIDsExtras g_namedCounterIDsExtras;
 static NamedIDsExtras g_namedTimerIDsExtras;
 static NamedIDsExtras g_namedEffectIDsExtras;
 static NamedIDsExtras g_namedColorIDsExtras;
+static std::array<std::uint32_t, static_cast<std::size_t>(NID::_INTERNAL_LAST)> g_generations{};
 
 geode::Result<NamedIDsExtras&> extrasContainerForNID(NID id)
 {
@@ -60,6 +64,42 @@ geode::Result<NamedIDsExtras&> extrasContainerForNID(NID id)
 	}
 }
 
+std::uint32_t& extrasGenerationForNID(NID id)
+{
+	switch (id)
+	{
+		case NID::DYNAMIC_COUNTER_TIMER: [[fallthrough]];
+		case NID::COUNTER:
+			return g_generations[static_cast<std::size_t>(NID::COUNTER)];
+
+		case NID::GROUP: [[fallthrough]];
+		case NID::COLLISION: [[fallthrough]];
+		case NID::TIMER: [[fallthrough]];
+		case NID::EFFECT: [[fallthrough]];
+		case NID::COLOR:
+			return g_generations[static_cast<std::size_t>(id)];
+
+		default:
+			return g_generations[0];
+	}
+}
+
+void bumpAllExtrasGenerations()
+{
+	for (auto& generation : g_generations)
+		generation++;
+}
+
+void indexAllDescriptions()
+{
+	auto& index = ng::types::DescriptionIndex::get();
+	index.clear();
+
+	for (auto nid : { NID::GROUP, NID::COLLISION, NID::COUNTER, NID::TIMER })
+		for (const auto& [id, extras] : extrasContainerForNID(nid).unwrap().extras)
+			index.set(nid, id, extras.description);
+}
+
 
 geode::Result<bool> NIDExtrasManager::getIsNamedIDPreviewed(NID nid, short id)
 {
@@ -122,6 +162,7 @@ geode::Result<> NIDExtrasManager::setNamedIDIsPreviewed(NID nid, short id, bool
 		ids[id].isPreviewed = state;
 
 	g_isDirty = true;
+	extrasGenerationForNID(nid)++;
 	NewNamedIDExtrasEvent().send(nid, id, ids[id]);
 
 	return geode::Ok();
@@ -153,6 +194,8 @@ geode::Result<> NIDExtrasManager::setNamedIDDescription(NID nid, short id, std::
 		ids[id].description = description;
 
 	g_isDirty = true;
+	extrasGenerationForNID(nid)++;
+	ng::types::DescriptionIndex::get().set(nid, id, description);
 	NewNamedIDExtrasEvent().send(nid, id, ids[id]);
 
 	return geode::Ok();
@@ -203,6 +246,8 @@ geode::Result<> NIDExtrasManager::setNamedIDExtras(NID nid, short id, NamedIDExt
 	ids.extras[id] = std::move(extras);
 
 	g_isDirty = true;
+	extrasGenerationForNID(nid)++;
+	ng::types::DescriptionIndex::get().set(nid, id, ids.extras[id].description);
 	NewNamedIDExtrasEvent().send(nid, id, ids.extras[id]);
 
 	return geode::Ok();
@@ -234,6 +279,8 @@ geode::Result<> NIDExtrasManager::removeNamedIDExtras(NID nid, short id)
 	ids.extras.erase(id);
 
 	g_isDirty = true;
+	extrasGenerationForNID(nid)++;
+	ng::types::DescriptionIndex::get().remove(nid, id);
 	RemovedNamedIDExtrasEvent().send(nid, id);
 
 	return geode::Ok();
@@ -263,9 +310,12 @@ geode::Result<NamedIDsExtras> NIDExtrasManager::getNIDExtras(NID nid)
 
 bool NIDExtrasManager::isDirty() { return g_isDirty; }
 
+std::uint32_t NIDExtrasManager::getGeneration(NID nid) { return extrasGenerationForNID(nid); }
+
 void NIDExtrasManager::init(int levelID)
 {
 	g_levelID = levelID;
+	bumpAllExtrasGenerations();
 
 	if (s_saveDataDir.empty())
 	{
@@ -327,6 +377,8 @@ void NIDExtrasManager::init(int levelID)
 	readNIDExtras(g_namedCollisionIDsExtras);
 	readNIDExtras(g_namedCounterIDsExtras);
 	readNIDExtras(g_namedTimerIDsExtras);
+
+	indexAllDescriptions();
 }
 
 void NIDExtrasManager::save()
@@ -369,7 +421,9 @@ void NIDExtrasManager::reset()
 	g_namedCollisionIDsExtras.extras.clear();
 	g_namedCounterIDsExtras.extras.clear();
 	g_namedTimerIDsExtras.extras.clear();
+	ng::types::DescriptionIndex::get().clear();
 
 	g_isDirty = false;
 	g_levelID = 0;
+	bumpAllExtrasGenerations();
 }
@@ -1,6 +1,11 @@
 #define GEODE_DEFINE_EVENT_EXPORTS
 #include <NIDManager.hpp>
 
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+#include <vector>
+
 #include "NamedIDs.hpp"
 
 #include "events/NewNamedIDEvent.hpp"
@@ -15,6 +20,15 @@ static NamedIDs g_namedCounters;
 static NamedIDs g_namedTimers;
 static NamedIDs g_namedEffects;
 static NamedIDs g_namedColors;
+static std::array<std::uint32_t, static_cast<std::size_t>(NID::_INTERNAL_LAST)> g_generations{};
+
+struct SortedNamedIDsView
+{
+	std::vector<NIDManager::SortedNamedID> entries;
+	std::uint32_t generation = 0;
+	bool built = false;
+};
+static std::array<SortedNamedIDsView, static_cast<std::size_t>(NID::_INTERNAL_LAST)> g_sortedViews;
 
 geode::Result<NamedIDs&> containerForNID(NID id)
 {
@@ -44,6 +58,32 @@ geode::Result<NamedIDs&> containerForNID(NID id)
 	}
 }
 
+std::uint32_t& generationForNID(NID id)
+{
+	switch (id)
+	{
+		case NID::DYNAMIC_COUNTER_TIMER: [[fallthrough]];
+		case NID::COUNTER:
+			return g_generations[static_cast<std::size_t>(NID::COUNTER)];
+
+		case NID::GROUP: [[fallthrough]];
+		case NID::COLLISION: [[fallthrough]];
+		case NID::TIMER: [[fallthrough]];
+		case NID::EFFECT: [[fallthrough]];
+		case NID::COLOR:
+			return g_generations[static_cast<std::size_t>(id)];
+
+		default:
+			return g_generations[0];
+	}
+}
+
+void bumpAllGenerations()
+{
+	for (auto& generation : g_generations)
+		generation++;
+}
+
 
 geode::Result<std::string> NIDManager::getNameForID(NID nid, short id)
 {
@@ -92,6 +132,7 @@ geode::Result<> NIDManager::saveNamedID(NID nid, std::string_view name, short id
 	ids.namedIDs[std::string{ name }] = id;
 
 	g_isDirty = true;
+	generationForNID(nid)++;
 	NewNamedIDEvent().send(nid, name, id);
 
 	return geode::Ok();
@@ -115,6 +156,7 @@ geode::Result<> NIDManager::removeNamedID(NID nid, std::string_view name)
 #endif
 
 	g_isDirty = true;
+	generationForNID(nid)++;
 	RemovedNamedIDEvent().send(nid, name, ids[name]);
 
 	return geode::Ok();
@@ -134,6 +176,7 @@ geode::Result<> NIDManager::removeNamedID(NID nid, short id)
 	ids.namedIDs.erase(name.unwrap());
 
 	g_isDirty = true;
+	generationForNID(nid)++;
 	RemovedNamedIDEvent().send(nid, name.unwrap(), id);
 
 	return geode::Ok();
@@ -193,6 +236,9 @@ geode::Result<> NIDManager::importNamedIDs(const std::string& str, bool setDirty
 
 	auto strView = std::string_view{ str };
 
+	// even a failed import may have replaced some of the containers
+	bumpAllGenerations();
+
 	auto firstDelimPos = strView.find('|');
 	auto secondDelimPos = strView.find('|', firstDelimPos + 1);
 	auto thirdDelimPos = strView.find('|', secondDelimPos + 1);
@@ -261,6 +307,83 @@ std::unordered_map<std::string, short, geode::utils::StringHash, std::equal_to<>
 	return cache.at(nid).namedIDs;
 }
 
+geode::Result<> NIDManager::saveNamedIDs(NID nid, std::span<const std::pair<std::string, short>> namedIDs)
+{
+	auto idsRes = containerForNID(nid);
+	if (idsRes.isErr())
+		return geode::Err(idsRes.unwrapErr());
+	auto& ids = idsRes.unwrap();
+
+	std::vector<const std::pair<std::string, short>*> validNamedIDs;
+	validNamedIDs.reserve(namedIDs.size());
+	std::unordered_set<short> savedIDs;
+	savedIDs.reserve(namedIDs.size());
+
+	for (const auto& namedID : namedIDs)
+	{
+#ifndef NID_DEBUG_BUILD
+		if (namedID.second <= 0)
+			continue;
+#endif // !NID_DEBUG_BUILD
+
+		if (ng::utils::sanitizeName(namedID.first).isErr())
+			continue;
+
+		validNamedIDs.push_back(&namedID);
+		savedIDs.insert(namedID.second);
+	}
+
+	if (!validNamedIDs.empty())
+	{
+		// the old names of every saved ID, in one pass instead of a getNameForID per ID
+		std::erase_if(ids.namedIDs, [&](const auto& p) { return savedIDs.contains(p.second); });
+
+		for (const auto namedID : validNamedIDs)
+			ids.namedIDs[namedID->first] = namedID->second;
+
+		g_isDirty = true;
+		generationForNID(nid)++;
+
+		for (const auto namedID : validNamedIDs)
+			NewNamedIDEvent().send(nid, namedID->first, namedID->second);
+	}
+
+	if (validNamedIDs.size() != namedIDs.size())
+		return geode::Err("{} invalid Named IDs were skipped", namedIDs.size() - validNamedIDs.size());
+
+	return geode::Ok();
+}
+
+std::span<const NIDManager::SortedNamedID> NIDManager::getSortedNamedIDs(NID nid)
+{
+	auto idsRes = containerForNID(nid);
+	if (idsRes.isErr())
+		return {};
+	const auto& ids = idsRes.unwrap();
+
+	// dynamic counters/timers share the counters container
+	auto& view = g_sortedViews[static_cast<std::size_t>(nid == NID::DYNAMIC_COUNTER_TIMER ? NID::COUNTER : nid)];
+	const auto generation = generationForNID(nid);
+
+	if (view.built && view.generation == generation)
+		return view.entries;
+
+	view.entries.clear();
+	view.entries.reserve(ids.namedIDs.size());
+
+	for (const auto& [name, id] : ids.namedIDs)
+		view.entries.push_back({ name, id });
+
+	std::ranges::sort(view.entries, {}, &SortedNamedID::id);
+
+	view.generation = generation;
+	view.built = true;
+
+	return view.entries;
+}
+
+std::uint32_t NIDManager::getGeneration(NID nid) { return generationForNID(nid); }
+
 void NIDManager::reset()
 {
 	g_namedGroups.namedIDs.clear();
@@ -271,4 +394,5 @@ void NIDManager::reset()
 	g_namedColors.namedIDs.clear();
 
 	g_isDirty = false;
+	bumpAllGenerations();
 }
@@ -1,10 +1,20 @@
 #include <Geode/modify/EditorUI.hpp>
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include <NIDManager.hpp>
 
 #include "IDFormatParser.hpp"
 
-#include "GameObjectData.hpp"
+#include "SelectionSnapshot.hpp"
+#include "AutoNameIndex.hpp"
+#include "LabelRefreshScheduler.hpp"
 
 #include "utils.hpp"
 #include "globals.hpp"
@@ -14,110 +24,130 @@ using namespace geode::prelude;
 
 struct NIDEditorUITweaks : geode::Modify<NIDEditorUITweaks, EditorUI>
 {
-	void dynamicGroupUpdate(bool isRegroup)
+	// an ID an object had before the update and the one it has now
+	struct IDChange
 	{
-		std::vector<short> errorredIDs;
+		NID nid;
+		short oldID;
+		short newID;
+	};
 
-		std::vector<ng::types::GameObjectData> origObjects;
-		origObjects.reserve(this->m_selectedObjects->count());
-		auto selectedObjects = CCArray::create();
+	void dynamicGroupUpdate(bool isRegroup)
+	{
+		// reused between updates, so regrouping doesn't allocate once it fits the selection
+		static ng::types::SelectionSnapshot origObjects;
+		origObjects.clear();
 
 		if (this->m_selectedObject)
-			origObjects.emplace_back(this->m_selectedObject);
+			origObjects.capture(this->m_selectedObject);
 		else
 			for (auto obj : CCArrayExt<GameObject*>(this->m_selectedObjects))
-				origObjects.emplace_back(obj);
+				origObjects.capture(obj);
 
 		EditorUI::dynamicGroupUpdate(isRegroup);
 
 		if (!this->m_selectedObject && !this->m_selectedObjects->count()) return;
 
-		if (this->m_selectedObject)
-			selectedObjects->addObject(this->m_selectedObject);
-		else
-			selectedObjects->addObjectsFromArray(this->m_selectedObjects);
+		// 1. which IDs changed
+		std::vector<IDChange> changes;
+		// every trigger with dynamic IDs, changed or not, their labels are refreshed after saving
+		std::vector<EffectGameObject*> dynamicTriggers;
+		// objects sharing an ID get the same new one, which only has to be named once
+		std::unordered_set<std::uint64_t> seenChanges;
 
-		for (auto idx = 0; auto& object : origObjects)
-		{
-			auto newObj = static_cast<GameObject*>(selectedObjects->objectAtIndex(idx));
+		auto addChange = [&](NID nid, short oldID, short newID) {
+			if (oldID <= 0 || oldID == newID) return;
+			if (!seenChanges.insert(changeKey(nid, oldID, newID)).second) return;
 
-			if (object.m_groupCount > 0 && newObj->m_groups)
-			{
-				for (auto idx = 0; short id : object.m_groups)
-				{
-					short oldID = object.m_groups.at(idx);
-					short newID = newObj->m_groups->at(idx);
+			changes.push_back({ nid, oldID, newID });
+		};
 
-					if (newID != oldID)
-					{
-						if (auto newName = autoNameObjectID(NID::GROUP, oldID))
-							(void)NIDManager::saveNamedID<NID::GROUP>(std::move(newName.unwrap()), newID);
-						else if (!newName.unwrapErr().empty())
-							errorredIDs.push_back(newID);
-					}
+		const std::size_t newObjectCount = this->m_selectedObject ? 1 : this->m_selectedObjects->count();
 
-					idx++;
-				}
-			}
+		for (std::size_t idx = 0; idx < origObjects.size() && idx < newObjectCount; idx++)
+		{
+			auto newObj = this->m_selectedObject
+				? this->m_selectedObject
+				: static_cast<GameObject*>(this->m_selectedObjects->objectAtIndex(idx));
 
-			if (object.m_classType == GameObjectClassType::Effect)
-			{
-				auto newEffectObj = static_cast<EffectGameObject*>(newObj);
+			if (!newObj) continue;
 
-				auto dynamicGroupGetters = ng::constants::OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS.find(newEffectObj->m_objectID);
+			// compared slot by slot, both hold every slot
+			if (newObj->m_groups)
+				for (std::size_t slot = 0; const short oldID : origObjects.getGroups(idx))
+					addChange(NID::GROUP, oldID, newObj->m_groups->at(slot++));
 
-				if (!newEffectObj || dynamicGroupGetters == ng::constants::OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS.end())
-					continue;
+			const auto dynamicGroupGetters = origObjects.getGetters(idx);
+			if (!dynamicGroupGetters) continue;
 
-				for (const auto& [nid, getters] : dynamicGroupGetters->second)
-				{
-					NID realNID = nid;
-					if (realNID == NID::_UNKNOWN) break;
+			auto newEffectObj = static_cast<EffectGameObject*>(newObj);
+			const auto oldValues = origObjects.getValues(idx);
 
-					const auto [dataGetter, objGetter] = getters;
-					if (objGetter(newEffectObj) == dataGetter(object)) continue;
+			dynamicTriggers.push_back(newEffectObj);
 
-					// Edit Area triggers ID can either be Group ID or Effect ID
-					// getTriggerValue doesn't use any members in SetupTriggerPopup
-					if (
-						newEffectObj->m_objectID >= 3011 && newEffectObj->m_objectID <= 3015 &&
-						static_cast<SetupTriggerPopup*>(nullptr)->getTriggerValue(355, newEffectObj) != .0f
-					)
-						realNID = NID::EFFECT;
+			for (std::size_t value = 0; const auto& [nid, getter] : *dynamicGroupGetters)
+			{
+				NID realNID = nid;
+				// unused slots of the getters map, which sort before the real ones
+				if (realNID == NID::_UNKNOWN) continue;
+
+				const int oldID = oldValues[value++];
+				const int newID = getter(newEffectObj);
+				if (newID == oldID) continue;
+
+				// Edit Area triggers ID can either be Group ID or Effect ID
+				// getTriggerValue doesn't use any members in SetupTriggerPopup
+				if (
+					newEffectObj->m_objectID >= 3011 && newEffectObj->m_objectID <= 3015 &&
+					static_cast<SetupTriggerPopup*>(nullptr)->getTriggerValue(355, newEffectObj) != .0f
+				)
+					realNID = NID::EFFECT;
+
+				if (realNID == NID::DYNAMIC_COUNTER_TIMER)
+				{
+					auto& toggleMap = ng::constants::DYNAMIC_PROPERTIES_TOGGLES.at(newEffectObj->m_objectID);
 
-					if (realNID == NID::DYNAMIC_COUNTER_TIMER)
+					for (const auto& [property, toggleInfo] : toggleMap)
 					{
-						auto& toggleMap = ng::constants::DYNAMIC_PROPERTIES_TOGGLES.at(newEffectObj->m_objectID);
+						auto propVal = static_cast<SetupTriggerPopup*>(nullptr)->getTriggerValue(
+							toggleInfo.togglePropID,
+							newEffectObj
+						);
 
-						for (const auto& [property, toggleInfo] : toggleMap)
+						if (propVal == toggleInfo.counterState)
 						{
-							auto propVal = static_cast<SetupTriggerPopup*>(nullptr)->getTriggerValue(
-								toggleInfo.togglePropID,
-								newEffectObj
-							);
-
-							if (propVal == toggleInfo.counterState)
-							{
-								realNID = NID::COUNTER;
-								break;
-							}
-							else
-								realNID = NID::TIMER;
+							realNID = NID::COUNTER;
+							break;
 						}
+						else
+							realNID = NID::TIMER;
 					}
-
-					if (auto newName = autoNameObjectID(realNID, dataGetter(object)))
-						(void)NIDManager::saveNamedID(realNID, std::move(newName.unwrap()), objGetter(newEffectObj));
-					else if (!newName.unwrapErr().empty())
-						errorredIDs.push_back(objGetter(newEffectObj));
 				}
 
-				this->m_editorLayer->updateObjectLabel(newEffectObj);
+				addChange(realNID, oldID, newID);
 			}
+		}
+
+		// 2. what the new IDs are called, against the Named IDs from before the update
+		std::array<std::vector<std::pair<std::string, short>>, static_cast<std::size_t>(NID::_INTERNAL_LAST)> newNames;
+		std::vector<short> errorredIDs;
 
-			idx++;
+		for (const auto& change : changes)
+		{
+			if (auto newName = autoNameObjectID(change.nid, change.oldID))
+				newNames[static_cast<std::size_t>(change.nid)].emplace_back(std::move(newName.unwrap()), change.newID);
+			else if (!newName.unwrapErr().empty())
+				errorredIDs.push_back(change.newID);
 		}
 
+		// 3. one save per ID type and one label refresh
+		for (std::size_t nid = 0; nid < newNames.size(); nid++)
+			if (!newNames[nid].empty())
+				(void)ng::types::AutoNameIndex::get().saveNamedIDs(static_cast<NID>(nid), newNames[nid]);
+
+		for (auto trigger : dynamicTriggers)
+			ng::types::LabelRefreshScheduler::get()->queue(trigger);
+
 		if (!errorredIDs.empty())
 			ng::utils::cocos::createNotificationToast(
 				this,
@@ -127,37 +157,63 @@ struct NIDEditorUITweaks : geode::Modify<NIDEditorUITweaks, EditorUI>
 	}
 
 
+	static std::uint64_t changeKey(NID nid, short oldID, short newID)
+	{
+		// counters and dynamic counters/timers share their Named IDs
+		if (nid == NID::DYNAMIC_COUNTER_TIMER)
+			nid = NID::COUNTER;
+
+		return
+			static_cast<std::uint64_t>(nid) << 32 |
+			static_cast<std::uint64_t>(static_cast<std::uint16_t>(oldID)) << 16 |
+			static_cast<std::uint16_t>(newID);
+	}
+
 	geode::Result<std::string> autoNameObjectID(NID nid, short id)
 	{
-		auto nameRes = NIDManager::getNameForID(nid, id);
-		if (nameRes.isErr()) return geode::Err("");
-		auto name = nameRes.unwrap();
+		// nothing is saved until every name is picked, so the sorted view stays valid
+		const auto namedIDs = NIDManager::getSortedNamedIDs(nid);
+		auto namedIDIt = std::ranges::lower_bound(namedIDs, id, {}, &NIDManager::SortedNamedID::id);
+		if (namedIDIt == namedIDs.end() || namedIDIt->id != id) return geode::Err("");
+		const std::string_view name = namedIDIt->name;
+
+		const auto& nameFormat = ng::globals::g_buildHelperNameFormat;
+		if (!nameFormat) return geode::Err(ng::globals::g_buildHelperNameFormatError);
 
-		auto tokensRes = ng::parser::parseFormat(ng::globals::g_buildHelperRawNameFormat);
-		if (tokensRes.isErr()) return geode::Err(tokensRes.unwrapErr());
-		auto& tokens = tokensRes.unwrap();
+		// names that don't follow the format yet count as its first ID
+		std::string_view baseName = name;
+		int number = 1;
 
-		auto fmtPairRes = ng::parser::extract(name, tokens);
-		if (fmtPairRes.isErr())
+		if (auto parts = nameFormat.extract(name))
 		{
-			fmtPairRes = ng::parser::extract(
-				ng::parser::format(tokens, { name, "1" }).unwrap(),
-				tokens
-			);
+			auto numRes = geode::utils::numFromString<int>(parts->id);
+			if (numRes.isErr()) return geode::Err("Invalid number in name");
+
+			baseName = parts->name;
+			number = numRes.unwrap();
+		}
+
+		std::array<char, 16> idBuffer;
+		std::string newName;
+		// the suffix after this name's if nothing else uses it, otherwise the one after the highest in use
+		int suffix = ng::types::AutoNameIndex::get().getFreeSuffix(nid, baseName, number + 1);
+
+		// formats where a base name can end in a number can still produce a name that's taken
+		do
+		{
+			const auto idEnd = std::to_chars(idBuffer.data(), idBuffer.data() + idBuffer.size(), suffix++).ptr;
+			nameFormat.format(baseName, std::string_view{ idBuffer.data(), idEnd }, newName);
 		}
-		auto& fmtPair = fmtPairRes.unwrap();
+		while (ng::types::AutoNameIndex::get().isTaken(nid, newName));
 
-		auto numRes = geode::utils::numFromString<int>(fmtPair.id);
-		if (numRes.isErr()) return geode::Err("Invalid number in name");
-		fmtPair.id = fmt::format("{}", numRes.unwrap() + 1);
+		if (newName.size() > ng::constants::MAX_NAMED_ID_LENGTH)
+			return geode::Err("Auto-named ID is too long ({})", newName.size());
 
-		auto fmtRes = ng::parser::format(tokens, fmtPair);
-		if (fmtRes.isErr()) return geode::Err(fmtRes.unwrapErr());
-		auto& fmt = fmtRes.unwrap();
+		if (auto sanitizeRes = ng::utils::sanitizeName(newName); sanitizeRes.isErr())
+			return geode::Err(sanitizeRes.unwrapErr());
 
-		if (fmt.size() > ng::constants::MAX_NAMED_ID_LENGTH)
-			return geode::Err("Auto-named ID is too long ({})", fmt.size());
+		ng::types::AutoNameIndex::get().reserve(nid, newName);
 
-		return geode::Ok(fmt);
+		return geode::Ok(std::move(newName));
 	}
 };
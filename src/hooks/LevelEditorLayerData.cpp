@@ -17,6 +17,9 @@
 #include "globals.hpp"
 #include "constants.hpp"
 #include "benchmark.hpp"
+#include "LabelRefreshScheduler.hpp"
+
+#include "../popups/AutofillNamedIDsPreview.hpp"
 
 using namespace geode::prelude;
 
@@ -44,6 +47,9 @@ void NIDLevelEditorLayerData::createObjectsFromSetup(gd::string& levelString)
 	}
 
 	LevelEditorLayer::createObjectsFromSetup(levelString);
+
+	// once the editor is done loading
+	Loader::get()->queueInMainThread([] { AutofillNamedIDsPreview::prewarm(); });
 }
 
 
@@ -211,6 +217,7 @@ void NIDEditorPauseLayerSave::onExitEditor(CCObject* sender)
 {
 	NIDManager::reset();
 	NIDExtrasManager::reset();
+	ng::types::LabelRefreshScheduler::get()->clear();
 
 	EditorPauseLayer::onExitEditor(sender);
 }
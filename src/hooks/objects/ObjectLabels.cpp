@@ -7,6 +7,8 @@
 #include "utils.hpp"
 #include "constants.hpp"
 #include "globals.hpp"
+#include "IDNameLabelBatch.hpp"
+#include "LabelRefreshScheduler.hpp"
 
 using namespace geode::prelude;
 
@@ -16,10 +18,25 @@ static auto objInArray = [](GameObject* object, const auto& container) {
 
 struct NIDEffectGameObject : geode::Modify<NIDEffectGameObject, EffectGameObject>
 {
+	// what the label was last computed from, so unchanged objects skip the Named ID lookups
+	struct LabelCache
+	{
+		NID nameNID = NID::_UNKNOWN;
+		short nameID = 0;
+		short secondNameID = 0;
+		std::uint32_t namesGeneration = 0;
+		std::string text;
+
+		NID previewNID = NID::_UNKNOWN;
+		short previewID = 0;
+		short secondPreviewID = 0;
+		std::uint32_t extrasGeneration = 0;
+		bool isPreviewed = true;
+	};
+
 	struct Fields
 	{
-		Ref<CCLabelBMFont> m_id_name_label = CCLabelBMFont::create("", "bigFont.fnt");
-		bool m_has_id_name_label = false;
+		LabelCache m_label_cache;
 	};
 
 	void customSetup()
@@ -36,14 +53,110 @@ struct NIDEffectGameObject : geode::Modify<NIDEffectGameObject, EffectGameObject
 
 		// lol why does the game not do this
 		this->setCascadeOpacityEnabled(true);
-
-		// 28.5f is content width of move trigger, which works well for all other triggers
-		m_fields->m_id_name_label->limitLabelWidth(28.5f + 10.f, .5f, .1f);
 	}
 };
 
 struct NIDLevelEditorLayer : geode::Modify<NIDLevelEditorLayer, LevelEditorLayer>
 {
+	// a label used to be drawn right after its own object, in between the objects of other Z layers.
+	// the batch only has one spot in the draw order, so every label is drawn above every object instead
+	static constexpr int ID_NAME_LABELS_Z_ORDER = 9999;
+
+	struct Fields
+	{
+		Ref<ng::types::IDNameLabelBatch> m_id_name_labels;
+
+		// what the labels were last synced under
+		PlaybackMode m_last_playback_mode = PlaybackMode::Not;
+		int m_last_layer = -1;
+	};
+
+	ng::types::IDNameLabelBatch* getIDNameLabelBatch()
+	{
+		auto& batch = m_fields->m_id_name_labels;
+
+		if (!batch)
+		{
+			batch = ng::types::IDNameLabelBatch::create("bigFont.fnt", this->m_objectLayer);
+			batch->setID("id-name-labels"_spr);
+			this->m_objectLayer->addChild(batch, ID_NAME_LABELS_Z_ORDER);
+		}
+
+		return batch;
+	}
+
+	void markLabelDirty(GameObject* object)
+	{
+		if (auto& batch = m_fields->m_id_name_labels)
+			batch->markDirty(object);
+	}
+
+	void markAllLabelsDirty()
+	{
+		if (auto& batch = m_fields->m_id_name_labels)
+			batch->markAllDirty();
+	}
+
+	void addSpecial(GameObject* object)
+	{
+		LevelEditorLayer::addSpecial(object);
+
+		markLabelDirty(object);
+	}
+
+	void removeObject(GameObject* object, bool noUndo)
+	{
+		LevelEditorLayer::removeObject(object, noUndo);
+
+		markLabelDirty(object);
+	}
+
+	void undoLastAction()
+	{
+		LevelEditorLayer::undoLastAction();
+
+		markAllLabelsDirty();
+	}
+
+	void redoLastAction()
+	{
+		LevelEditorLayer::redoLastAction();
+
+		markAllLabelsDirty();
+	}
+
+	// runs every frame, after the editor faded and hid the objects
+	void updateVisibility(float dt)
+	{
+		LevelEditorLayer::updateVisibility(dt);
+
+		auto& batch = m_fields->m_id_name_labels;
+		if (!batch) return;
+
+		// the playtest moves any object, switching the editor layer fades them,
+		// and stopping the playtest puts them back
+		if (
+			this->m_playbackMode != PlaybackMode::Not || m_fields->m_last_playback_mode != PlaybackMode::Not ||
+			this->m_currentLayer != m_fields->m_last_layer
+		)
+		{
+			m_fields->m_last_playback_mode = this->m_playbackMode;
+			m_fields->m_last_layer = this->m_currentLayer;
+
+			return batch->markAllDirty();
+		}
+
+		// moving, rotating, scaling and flipping only ever touch the selection
+		auto editorUI = this->m_editorUI;
+		if (!editorUI) return;
+
+		if (editorUI->m_selectedObject)
+			batch->markDirty(editorUI->m_selectedObject);
+		else if (editorUI->m_selectedObjects)
+			for (auto object : CCArrayExt<GameObject*>(editorUI->m_selectedObjects))
+				batch->markDirty(object);
+	}
+
 	static void updateObjectLabel(GameObject* object)
 	{
 		LevelEditorLayer::updateObjectLabel(object);
@@ -56,12 +169,19 @@ struct NIDLevelEditorLayer : geode::Modify<NIDLevelEditorLayer, LevelEditorLayer
 		if (!(isTrigger || isCollision || isCounter || isTimer))
 			return;
 
+		auto lel = static_cast<NIDLevelEditorLayer*>(LevelEditorLayer::get());
+		// objects get their labels updated while the editor is still being created
+		if (!lel)
+			return ng::types::LabelRefreshScheduler::get()->queue(object);
+
+		auto batch = lel->getIDNameLabelBatch();
+		if (batch->isZoomedOut())
+			return batch->deferLabel(object);
+
 		auto effectGameObj = static_cast<NIDEffectGameObject*>(object);
 
-		CCLabelBMFont* idNameLabel = effectGameObj->m_fields->m_id_name_label;
-		bool& hasIDNameLabel = effectGameObj->m_fields->m_has_id_name_label;
-		std::string idNameStr = "";
 		CCPoint idLabelPos;
+		bool isLabelVisible = true;
 
 		switch (object->m_objectID)
 		{
@@ -101,6 +221,11 @@ struct NIDLevelEditorLayer : geode::Modify<NIDLevelEditorLayer, LevelEditorLayer
 				break;
 		}
 
+		// which Named ID(s) the label shows, _INVALID if it shows none
+		NID nameNID = NID::_INVALID;
+		short nameID = 0;
+		short secondNameID = 0;
+
 		switch (object->m_objectID)
 		{
 			// Counter Trigger
@@ -109,44 +234,29 @@ struct NIDLevelEditorLayer : geode::Modify<NIDLevelEditorLayer, LevelEditorLayer
 		
 				// Disable if counter should show MainTime/Points/Attempts
 				if (labelNode->m_shownSpecial != 0);
-				else if (labelNode->m_isTimeCounter)
-					idNameStr = NIDManager::getNameForID<NID::TIMER>(
-						effectGameObj->m_itemID
-					).unwrapOr("");
 				else
-					idNameStr = NIDManager::getNameForID<NID::COUNTER>(
-						effectGameObj->m_itemID
-					).unwrapOr("");
+				{
+					nameNID = labelNode->m_isTimeCounter ? NID::TIMER : NID::COUNTER;
+					nameID = effectGameObj->m_itemID;
+				}
 			}
 			break;
 
 			// Pulse Trigger
 			case 1006u: {
 				auto pulseTrigger = static_cast<EffectGameObject*>(object);
-		
-				if (pulseTrigger->m_pulseTargetType == 1)
-					idNameStr = NIDManager::getNameForID<NID::GROUP>(
-						effectGameObj->m_targetGroupID
-					).unwrapOr("");
-				else
-					idNameStr = NIDManager::getNameForID<NID::COLOR>(
-						effectGameObj->m_targetGroupID
-					).unwrapOr("");
+
+				nameNID = pulseTrigger->m_pulseTargetType == 1 ? NID::GROUP : NID::COLOR;
+				nameID = effectGameObj->m_targetGroupID;
 			}
 			break;
 
 			// Random Trigger
 			case 1912u: {
-				auto id1 = NIDManager::getNameForID<NID::GROUP>(
-					effectGameObj->m_targetGroupID
-				).unwrapOr("");
-				auto id2 = NIDManager::getNameForID<NID::GROUP>(
-					effectGameObj->m_centerGroupID
-				).unwrapOr("");
-		
-				if (!id1.empty() && !id2.empty())
-					idNameStr = fmt::format("{}/\n{}", id1, id2);
-		
+				nameNID = NID::GROUP;
+				nameID = effectGameObj->m_targetGroupID;
+				secondNameID = effectGameObj->m_centerGroupID;
+
 				idLabelPos = CCPoint{ idLabelPos.x + .75f, idLabelPos.y - 5.5f };
 			}
 			break;
@@ -154,37 +264,60 @@ struct NIDLevelEditorLayer : geode::Modify<NIDLevelEditorLayer, LevelEditorLayer
 			// Color Trigger
 			case 899u: {
 				if (!(effectGameObj->m_usesPlayerColor1 || effectGameObj->m_usesPlayerColor2))
-					idNameStr = NIDManager::getNameForID<NID::COLOR>(
-						effectGameObj->m_targetColor
-					).unwrapOr("");
+				{
+					nameNID = NID::COLOR;
+					nameID = effectGameObj->m_targetColor;
+				}
 			}
 			break;
 
 			default: {
 				if (isTrigger)
-					idNameStr = NIDManager::getNameForID<NID::GROUP>(
-						effectGameObj->m_targetGroupID
-					).unwrapOr("");
-				else if (isCollision)
-					idNameStr = NIDManager::getNameForID<NID::COLLISION>(
-						effectGameObj->m_itemID
-					).unwrapOr("");
-				else if (isCounter)
-					idNameStr = NIDManager::getNameForID<NID::COUNTER>(
-						effectGameObj->m_itemID
-					).unwrapOr("");
-				else if (isTimer)
-					idNameStr = NIDManager::getNameForID<NID::TIMER>(
-						effectGameObj->m_itemID
-					).unwrapOr("");
+				{
+					nameNID = NID::GROUP;
+					nameID = effectGameObj->m_targetGroupID;
+				}
+				else
+				{
+					nameNID = isCollision ? NID::COLLISION : isCounter ? NID::COUNTER : NID::TIMER;
+					nameID = effectGameObj->m_itemID;
+				}
 			}
 			break;
 		}
 
+		auto& cache = effectGameObj->m_fields->m_label_cache;
+
+		if (
+			const auto generation = nameNID == NID::_INVALID ? 0u : NIDManager::getGeneration(nameNID);
+			cache.nameNID != nameNID || cache.nameID != nameID || cache.secondNameID != secondNameID ||
+			cache.namesGeneration != generation
+		)
+		{
+			cache.nameNID = nameNID;
+			cache.nameID = nameID;
+			cache.secondNameID = secondNameID;
+			cache.namesGeneration = generation;
+
+			if (nameNID == NID::_INVALID)
+				cache.text.clear();
+			// Random Trigger
+			else if (object->m_objectID == 1912u)
+			{
+				auto id1 = NIDManager::getNameForID(nameNID, nameID).unwrapOr("");
+				auto id2 = NIDManager::getNameForID(nameNID, secondNameID).unwrapOr("");
+
+				cache.text = !id1.empty() && !id2.empty()
+					? fmt::format("{}/\n{}", id1, id2)
+					: "";
+			}
+			else
+				cache.text = NIDManager::getNameForID(nameNID, nameID).unwrapOr("");
+		}
+
 		if (ng::globals::g_isEditorIDAPILoaded)
 		{
 			NID nid;
-			short id;
 
 			if (isTrigger)
 				nid = NID::GROUP;
@@ -192,35 +325,39 @@ struct NIDLevelEditorLayer : geode::Modify<NIDLevelEditorLayer, LevelEditorLayer
 				nid = NID::COLLISION;
 			else if (isCounter)
 				nid = NID::COUNTER;
-			else if (isTimer)
+			else
 				nid = NID::TIMER;
 
-			if (isTrigger)
-			{
-				idNameLabel->setVisible(
-					NIDExtrasManager::getIsNamedIDPreviewed(nid, effectGameObj->m_targetGroupID).unwrapOr(true) &&
-					NIDExtrasManager::getIsNamedIDPreviewed(nid, effectGameObj->m_centerGroupID).unwrapOr(true)
-				);
-			}
-			else
-			{
-				idNameLabel->setVisible(
-					NIDExtrasManager::getIsNamedIDPreviewed(nid, effectGameObj->m_itemID).unwrapOr(true)
-				);
-			}
-		}
+			const short previewID = isTrigger ? effectGameObj->m_targetGroupID : effectGameObj->m_itemID;
+			const short secondPreviewID = isTrigger ? effectGameObj->m_centerGroupID : 0;
 
-		idNameLabel->setString(idNameStr.c_str());
-		// 28.5f is content width of move trigger, which works well for all other triggers
-		idNameLabel->limitLabelWidth(28.5f + 10.f, .5f, .1f);
-		idNameLabel->setPosition({ idLabelPos.x, idLabelPos.y - 9.f });
+			if (
+				const auto generation = NIDExtrasManager::getGeneration(nid);
+				cache.previewNID != nid || cache.previewID != previewID || cache.secondPreviewID != secondPreviewID ||
+				cache.extrasGeneration != generation
+			)
+			{
+				cache.previewNID = nid;
+				cache.previewID = previewID;
+				cache.secondPreviewID = secondPreviewID;
+				cache.extrasGeneration = generation;
 
-		if (!hasIDNameLabel)
-		{
-			hasIDNameLabel = true;
+				if (isTrigger)
+					cache.isPreviewed =
+						NIDExtrasManager::getIsNamedIDPreviewed(nid, previewID).unwrapOr(true) &&
+						NIDExtrasManager::getIsNamedIDPreviewed(nid, secondPreviewID).unwrapOr(true);
+				else
+					cache.isPreviewed = NIDExtrasManager::getIsNamedIDPreviewed(nid, previewID).unwrapOr(true);
+			}
 
-			idNameLabel->setID("id-name-label"_spr);
-			object->addChild(idNameLabel);
+			isLabelVisible = cache.isPreviewed;
 		}
+
+		batch->setLabel(
+			object,
+			cache.text,
+			{ idLabelPos.x, idLabelPos.y - 9.f },
+			isLabelVisible
+		);
 	}
 };
@@ -1,5 +1,13 @@
 #include <Geode/modify/SetGroupIDLayer.hpp>
 
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <NIDManager.hpp>
 
 #include "../popups/EditNamedIDPopup.hpp"
@@ -17,6 +25,23 @@ struct NIDSetGroupIDLayer : geode::Modify<NIDSetGroupIDLayer, SetGroupIDLayer>
 	// used to make the named group button
 	static constexpr float PADDING = 10.f;
 	static constexpr float TOTAL_PADDING = PADDING * 2.f;
+	static constexpr std::size_t MAX_CACHED_BUTTON_SPRITES = 512;
+
+	struct GroupButtonSpriteKey
+	{
+		short id;
+		std::string name;
+		std::string_view style;
+
+		auto operator<=>(const GroupButtonSpriteKey&) const = default;
+	};
+
+	struct GroupButtonSpriteCache
+	{
+		std::map<GroupButtonSpriteKey, Ref<ButtonSprite>> sprites;
+		// Named group generation the entries were last checked against
+		std::uint32_t generation = 0;
+	};
 
 	struct Fields
 	{
@@ -194,43 +219,54 @@ struct NIDSetGroupIDLayer : geode::Modify<NIDSetGroupIDLayer, SetGroupIDLayer>
 
 		const auto LEL = LevelEditorLayer::get();
 		bool isOnlyObject = static_cast<bool>(this->m_targetObject);
-		// TODO: use std::span
-		std::set<short> commonIDs;
-		std::set<short> groupParentIDs;
-		std::vector<std::set<short>> groupIDs;
+		std::bitset<ng::constants::MAX_ID + 1> commonIDs;
+		std::bitset<ng::constants::MAX_ID + 1> groupParentIDs;
 
 		if (!isOnlyObject)
 		{
-			groupIDs.reserve(this->m_targetObjects->count());
+			// how many of the selected objects are in each group, the common ones are those every object is in
+			std::vector<std::uint32_t> groupCounts(ng::constants::MAX_ID + 1, 0u);
+			std::uint32_t objectsWithGroups = 0;
 
 			for (auto obj : CCArrayExt<GameObject*>(this->m_targetObjects))
 			{
-				log::debug("{}:", obj->m_objectID);
-				log::pushNest();
-				if (obj->m_groups)
+				if (!obj->m_groups) continue;
+
+				objectsWithGroups++;
+
+				const auto begin = obj->m_groups->begin();
+				const auto end = obj->m_groups->end();
+
+				for (auto it = begin; it != end; ++it)
 				{
-					for (short id : *obj->m_groups)
-						if (obj == LEL->m_parentGroupsDict->objectForKey(id))
-							groupParentIDs.insert(id);
+					const short id = *it;
 
-					std::set<short> objIDs;
-					objIDs.insert(obj->m_groups->begin(), obj->m_groups->end());
 					// why is this game like this
-					objIDs.erase(0);
-					log::debug("IDs: {}", fmt::join(objIDs, ", "));
-					groupIDs.emplace_back(std::move(objIDs));
+					if (id <= 0 || id > ng::constants::MAX_ID) continue;
+					// don't count an object twice for the same group
+					if (std::find(begin, it, id) != it) continue;
+
+					groupCounts[id]++;
+
+					if (obj == LEL->m_parentGroupsDict->objectForKey(id))
+						groupParentIDs.set(id);
 				}
-				log::popNest();
+
+				NID_DEBUG(log::debug("{}: {}", obj->m_objectID, fmt::join(begin, end, ", "));)
 			}
 
-			commonIDs = ng::utils::multiSetIntersection(std::move(groupIDs));
-			log::debug("Common IDs: {}", fmt::join(commonIDs, ", "));
+			if (objectsWithGroups != 0)
+				for (short id = 1; id <= ng::constants::MAX_ID; id++)
+					if (groupCounts[id] == objectsWithGroups)
+						commonIDs.set(id);
+
+			NID_DEBUG(log::debug("Common IDs: {}", commonIDs.count());)
 		}
 		else if (LEL->m_parentGroupsDict && this->m_targetObject->m_groups)
 		{
 			for (short id : *this->m_targetObject->m_groups)
-				if (this->m_targetObject == LEL->m_parentGroupsDict->objectForKey(id))
-					groupParentIDs.insert(id);
+				if (id > 0 && id <= ng::constants::MAX_ID && this->m_targetObject == LEL->m_parentGroupsDict->objectForKey(id))
+					groupParentIDs.set(id);
 		}
 
 
@@ -243,23 +279,9 @@ struct NIDSetGroupIDLayer : geode::Modify<NIDSetGroupIDLayer, SetGroupIDLayer>
 
 			if (auto name = NIDManager::getNameForID<NID::GROUP>(button->getTag()); name.isOk())
 			{
-				bool isGroupParent = groupParentIDs.contains(button->getTag());
+				bool isGroupParent = groupParentIDs[button->getTag()];
 
-				auto nameLabel = CCLabelBMFont::create(
-					name.unwrap().c_str(),
-					"bigFont.fnt"
-				);
-				nameLabel->setScale(.5f);
-				nameLabel->limitLabelWidth(70.f, .5f, .1f);
-
-				auto idLabel = CCLabelBMFont::create(
-					fmt::format("{}", button->getTag()).c_str(),
-					"goldFont.fnt"
-				);
-				idLabel->setScale(.5f);
-				idLabel->setZOrder(-1);
-
-				std::string buttonSpriteSpr = "";
+				const char* buttonSpriteSpr = "";
 
 				if (isOnlyObject)
 					buttonSpriteSpr = isGroupParent
@@ -268,57 +290,11 @@ struct NIDSetGroupIDLayer : geode::Modify<NIDSetGroupIDLayer, SetGroupIDLayer>
 				else
 					buttonSpriteSpr = isGroupParent
 						? "GJ_button_03.png"
-						: !commonIDs.contains(button->getTag())
+						: !commonIDs[button->getTag()]
 							? "GJ_button_05.png"
 							: "GJ_button_04.png";
 
-				auto buttonSprite = ButtonSprite::create(
-					"",
-					nameLabel->getScaledContentWidth() + idLabel->getScaledContentWidth() + PADDING,
-					0, .5f, true, "goldFont.fnt",
-					buttonSpriteSpr.c_str(),
-					20.f
-				);
-				buttonSprite->m_label->removeFromParent();
-
-				auto labelsContainer = CCNode::create();
-				labelsContainer->addChild(idLabel);
-				labelsContainer->addChild(nameLabel);
-				labelsContainer->setContentSize(buttonSprite->getContentSize());
-				labelsContainer->setAnchorPoint({ .5f, .5f });
-				labelsContainer->setPosition(buttonSprite->m_BGSprite->getPosition());
-				buttonSprite->addChild(labelsContainer);
-
-				// labels positioning (layouts are brokey in small content sizes :broken_heart:)
-				{
-					const float idLabelWidth = idLabel->getScaledContentWidth();
-					const float nameLabelWidth = nameLabel->getScaledContentWidth();
-					const CCSize parentSize = labelsContainer->getContentSize();
-
-					// add 2.f to Y pos because the exact middle makes the label overlap with the shadow of the background
-					idLabel->setPosition({
-						PADDING + idLabelWidth / 2.f,
-						parentSize.height / 2.f + 2.f
-					});
-					nameLabel->setPosition({
-						parentSize.width - PADDING - nameLabelWidth / 2.f,
-						parentSize.height / 2.f + 2.f
-					});
-				}
-
-				// ID label background
-				{
-					const auto idLabelPos = idLabel->getPosition();
-					const auto idLabelSize = idLabel->getScaledContentSize();
-
-					auto background = CCSprite::create("square02b_001.png");
-					background->setScaleX(idLabelSize.width / background->getScaledContentWidth() + .05f);
-					background->setScaleY(idLabelSize.height / background->getScaledContentHeight() - .02f);
-					background->setColor({ 0, 0, 0 });
-					background->setOpacity(100);
-					background->setPosition({  idLabelPos.x, idLabelPos.y - 1.5f });
-					labelsContainer->addChild(background, -2);
-				}
+				auto buttonSprite = getGroupButtonSprite(button->getTag(), name.unwrap(), buttonSpriteSpr);
 
 				auto newButton = CCMenuItemSpriteExtra::create(
 					buttonSprite,
@@ -343,6 +319,113 @@ struct NIDSetGroupIDLayer : geode::Modify<NIDSetGroupIDLayer, SetGroupIDLayer>
 	}
 
 
+	// the game rebuilds every group button on each update, so the composed sprites are kept around and only
+	// the ones whose group ID, name or style isn't cached yet get created
+	static ButtonSprite* getGroupButtonSprite(short id, const std::string& name, const char* style)
+	{
+		// leaked so the sprites aren't released after cocos shuts down
+		static auto* cache = new GroupButtonSpriteCache();
+
+		// renamed and removed groups leave entries nothing can hit anymore
+		if (const auto generation = NIDManager::getGeneration(NID::GROUP); cache->generation != generation)
+		{
+			cache->generation = generation;
+
+			const auto namedIDs = NIDManager::getSortedNamedIDs(NID::GROUP);
+
+			std::erase_if(cache->sprites, [&namedIDs](const auto& entry) {
+				auto it = std::ranges::lower_bound(namedIDs, entry.first.id, {}, &NIDManager::SortedNamedID::id);
+
+				return it == namedIDs.end() || it->id != entry.first.id || it->name != entry.first.name;
+			});
+		}
+
+		GroupButtonSpriteKey key{ id, name, style };
+
+		if (auto it = cache->sprites.find(key); it != cache->sprites.end())
+		{
+			// still inside the button the game just threw away
+			it->second->removeFromParent();
+			return it->second;
+		}
+
+		if (cache->sprites.size() >= MAX_CACHED_BUTTON_SPRITES)
+			cache->sprites.clear();
+
+		auto buttonSprite = createGroupButtonSprite(id, name, style);
+		cache->sprites.emplace(std::move(key), buttonSprite);
+
+		return buttonSprite;
+	}
+
+	// composes the named group button sprite, without a menu item so it can be reused
+	static ButtonSprite* createGroupButtonSprite(short id, const std::string& name, const char* style)
+	{
+		auto nameLabel = CCLabelBMFont::create(
+			name.c_str(),
+			"bigFont.fnt"
+		);
+		nameLabel->setScale(.5f);
+		nameLabel->limitLabelWidth(70.f, .5f, .1f);
+
+		auto idLabel = CCLabelBMFont::create(
+			fmt::format("{}", id).c_str(),
+			"goldFont.fnt"
+		);
+		idLabel->setScale(.5f);
+		idLabel->setZOrder(-1);
+
+		auto buttonSprite = ButtonSprite::create(
+			"",
+			nameLabel->getScaledContentWidth() + idLabel->getScaledContentWidth() + PADDING,
+			0, .5f, true, "goldFont.fnt",
+			style,
+			20.f
+		);
+		buttonSprite->m_label->removeFromParent();
+
+		auto labelsContainer = CCNode::create();
+		labelsContainer->addChild(idLabel);
+		labelsContainer->addChild(nameLabel);
+		labelsContainer->setContentSize(buttonSprite->getContentSize());
+		labelsContainer->setAnchorPoint({ .5f, .5f });
+		labelsContainer->setPosition(buttonSprite->m_BGSprite->getPosition());
+		buttonSprite->addChild(labelsContainer);
+
+		// labels positioning (layouts are brokey in small content sizes :broken_heart:)
+		{
+			const float idLabelWidth = idLabel->getScaledContentWidth();
+			const float nameLabelWidth = nameLabel->getScaledContentWidth();
+			const CCSize parentSize = labelsContainer->getContentSize();
+
+			// add 2.f to Y pos because the exact middle makes the label overlap with the shadow of the background
+			idLabel->setPosition({
+				PADDING + idLabelWidth / 2.f,
+				parentSize.height / 2.f + 2.f
+			});
+			nameLabel->setPosition({
+				parentSize.width - PADDING - nameLabelWidth / 2.f,
+				parentSize.height / 2.f + 2.f
+			});
+		}
+
+		// ID label background
+		{
+			const auto idLabelPos = idLabel->getPosition();
+			const auto idLabelSize = idLabel->getScaledContentSize();
+
+			auto background = CCSprite::create("square02b_001.png");
+			background->setScaleX(idLabelSize.width / background->getScaledContentWidth() + .05f);
+			background->setScaleY(idLabelSize.height / background->getScaledContentHeight() - .02f);
+			background->setColor({ 0, 0, 0 });
+			background->setOpacity(100);
+			background->setPosition({  idLabelPos.x, idLabelPos.y - 1.5f });
+			labelsContainer->addChild(background, -2);
+		}
+
+		return buttonSprite;
+	}
+
 	void onEditGroupNameButton(CCObject*)
 	{
 		EditNamedIDPopup<NID::GROUP>::create(this->m_groupIDValue,
@@ -7,6 +7,8 @@
 #include <NIDManager.hpp>
 
 #include <ranges>
+#include <string_view>
+#include <vector>
 
 #include "utils.hpp"
 #include "vmthooker.hpp"
@@ -23,9 +25,22 @@ struct NIDSetupSpawnPopup : geode::Modify<NIDSetupSpawnPopup, SetupSpawnPopup>
 	static constexpr std::uint16_t ORIGINAL_ID_PROPERTY = -1;
 	static constexpr std::uint16_t NEW_ID_PROPERTY = -2;
 
+	// what a remap button was last built for
+	struct RemapButton
+	{
+		int originalID;
+		int newID;
+		std::string_view style;
+		CCMenuItemSpriteExtra* button;
+	};
+
 	struct Fields
 	{
 		CCMenu* m_remaps_list_menu;
+		std::vector<RemapButton> m_remap_buttons;
+		// remaps of every object and the selected remap, as of the last update
+		std::vector<int> m_remaps_snapshot;
+		std::uint32_t m_names_generation = 0;
 	};
 
 	bool init(EffectGameObject* p0, CCArray* p1)
@@ -206,6 +221,22 @@ struct NIDSetupSpawnPopup : geode::Modify<NIDSetupSpawnPopup, SetupSpawnPopup>
 
 	void updateRemapButtons(float dt)
 	{
+		SetupSpawnPopup::updateRemapButtons(dt);
+
+		CCMenu* remapsListMenu = m_fields->m_remaps_list_menu;
+		if (!remapsListMenu) return;
+
+		// the game rebuilds its own buttons every time
+		for (auto button : CCArrayExt<CCMenuItemSpriteExtra*>(this->m_remapButtons))
+			button->setVisible(false);
+
+		const auto namesGeneration = NIDManager::getGeneration(NID::GROUP);
+		const bool namesChanged = namesGeneration != m_fields->m_names_generation;
+		m_fields->m_names_generation = namesGeneration;
+
+		// nothing to relabel, the buttons already show these remaps
+		if (!this->updateRemapsSnapshot() && !namesChanged) return;
+
 		std::vector<std::span<ChanceObject>> remapVecViews;
 		if (this->m_gameObjects)
 		{
@@ -235,79 +266,168 @@ struct NIDSetupSpawnPopup : geode::Modify<NIDSetupSpawnPopup, SetupSpawnPopup>
 			[](auto& obj) { return &obj; }
 		);
 
-		SetupSpawnPopup::updateRemapButtons(dt);
+		auto& remapButtons = m_fields->m_remap_buttons;
+		std::size_t idx = 0;
 
-		CCMenu* remapsListMenu = m_fields->m_remaps_list_menu;
-		if (!remapsListMenu) return;
-
-		remapsListMenu->removeAllChildren();
-
-		for (auto button : CCArrayExt<CCMenuItemSpriteExtra*>(this->m_remapButtons))
-			button->setVisible(false);
-
-		for (std::size_t idx = 0; const auto& remapObj : uniqueRemapObjects)
+		for (const auto& remapObj : uniqueRemapObjects)
 		{
 			// maybe paginate this as well
 			if (idx >= 20) break;
 
-			auto newButtonSprite = ButtonSprite::create(
-				fmt::format("{}\n{}", remapObj->m_groupID, remapObj->m_chance).c_str(),
-				40, 0, .35f, true, "bigFont.fnt",
+			const std::string_view style =
 				(this->m_remapOriginalID == remapObj->m_groupID && this->m_remapNewID == remapObj->m_chance)
 					? "GJ_button_03.png"
 					: !commonRemapObjects.contains(remapObj)
 						? "GJ_button_05.png"
-						: "GJ_button_04.png",
-				30.f
-			);
+						: "GJ_button_04.png";
 
-			auto oldIDNameRes = NIDManager::getNameForID<NID::GROUP>(remapObj->m_groupID);
-			auto newIDNameRes = NIDManager::getNameForID<NID::GROUP>(remapObj->m_chance);
-
-			if (oldIDNameRes.isOk() && newIDNameRes.isOk())
+			if (idx < remapButtons.size())
 			{
-				auto& oldIDName = oldIDNameRes.unwrap();
-				auto& newIDName = newIDNameRes.unwrap();
-
-				newButtonSprite->m_label->setString(
-					fmt::format(
-						"{} ({})",
-						oldIDName, remapObj->m_groupID
-					).c_str()
-				);
-
-				auto buttonLabelPos = newButtonSprite->m_label->getPosition();
-				auto newNameLabel = CCLabelBMFont::create(
-					fmt::format("{} ({})", newIDName, remapObj->m_chance).c_str(),
-					"bigFont.fnt"
-				);
-				newNameLabel->limitLabelWidth(48.f, .35f, .1f);
-				newButtonSprite->m_label->limitLabelWidth(48.f, .35f, .1f);
-				newButtonSprite->m_label->setPositionY(buttonLabelPos.y + 4.f);
-				newNameLabel->setPosition({ buttonLabelPos.x, buttonLabelPos.y - 6.f });
-				newButtonSprite->addChild(newNameLabel);
-			}
+				auto& remapButton = remapButtons[idx];
 
-			auto newButton = CCMenuItemSpriteExtra::create(
-				newButtonSprite,
-				nullptr,
-				this,
-				menu_selector(NIDSetupSpawnPopup::onSelectNewRemap)
-			);
-			newButton->setTag(idx);
-			remapsListMenu->addChild(newButton);
+				if (
+					!namesChanged && remapButton.originalID == remapObj->m_groupID &&
+					remapButton.newID == remapObj->m_chance && remapButton.style == style
+				)
+				{
+					idx++;
+					continue;
+				}
+
+				this->removeRemapButton(remapButton.button);
+				remapButton = { remapObj->m_groupID, remapObj->m_chance, style, this->createRemapButton(remapObj, style, idx) };
+			}
+			else
+				remapButtons.push_back({ remapObj->m_groupID, remapObj->m_chance, style, this->createRemapButton(remapObj, style, idx) });
 
 			// hide the buttons if its the first call after init
-			if (dt == 420.f) newButton->setVisible(false);
-			static_cast<CCArray*>(this->m_pageContainers->objectAtIndex(1))->addObject(newButton);
-			static_cast<CCArray*>(this->m_groupContainers->objectAtIndex(0))->addObject(newButton);
+			if (dt == 420.f) remapButtons[idx].button->setVisible(false);
 
 			idx++;
 		}
 
+		for (std::size_t i = idx; i < remapButtons.size(); i++)
+			this->removeRemapButton(remapButtons[i].button);
+		remapButtons.resize(idx);
+
+		// kept buttons have to stay in the same order as the remaps
+		for (std::size_t i = 0; i < remapButtons.size(); i++)
+			remapButtons[i].button->setZOrder(i);
+
 		remapsListMenu->updateLayout();
 	}
 
+	// records the remaps of every object and the selected remap, returns whether they differ from the last ones
+	bool updateRemapsSnapshot()
+	{
+		auto& snapshot = m_fields->m_remaps_snapshot;
+		std::size_t pos = 0;
+		bool changed = false;
+
+		// overwrites in place, so an unchanged popup doesn't allocate
+		auto record = [&](int value) {
+			if (pos == snapshot.size())
+			{
+				snapshot.push_back(value);
+				changed = true;
+			}
+			else if (snapshot[pos] != value)
+			{
+				snapshot[pos] = value;
+				changed = true;
+			}
+
+			pos++;
+		};
+		auto recordRemaps = [&](SpawnTriggerGameObject* obj) {
+			record(static_cast<int>(obj->m_remapObjects.size()));
+
+			for (const auto& remap : obj->m_remapObjects)
+			{
+				record(remap.m_groupID);
+				record(remap.m_oldGroupID);
+				record(remap.m_chance);
+				record(remap.m_unk00c);
+			}
+		};
+
+		record(this->m_remapOriginalID);
+		record(this->m_remapNewID);
+
+		if (this->m_gameObjects)
+			for (auto obj : CCArrayExt<SpawnTriggerGameObject*>(this->m_gameObjects))
+				recordRemaps(obj);
+		else
+			recordRemaps(static_cast<SpawnTriggerGameObject*>(this->m_gameObject));
+
+		if (pos != snapshot.size())
+		{
+			snapshot.resize(pos);
+			changed = true;
+		}
+
+		return changed;
+	}
+
+	CCMenuItemSpriteExtra* createRemapButton(ChanceObject* remapObj, std::string_view style, std::size_t idx)
+	{
+		auto newButtonSprite = ButtonSprite::create(
+			fmt::format("{}\n{}", remapObj->m_groupID, remapObj->m_chance).c_str(),
+			40, 0, .35f, true, "bigFont.fnt",
+			style.data(),
+			30.f
+		);
+
+		auto oldIDNameRes = NIDManager::getNameForID<NID::GROUP>(remapObj->m_groupID);
+		auto newIDNameRes = NIDManager::getNameForID<NID::GROUP>(remapObj->m_chance);
+
+		if (oldIDNameRes.isOk() && newIDNameRes.isOk())
+		{
+			auto& oldIDName = oldIDNameRes.unwrap();
+			auto& newIDName = newIDNameRes.unwrap();
+
+			newButtonSprite->m_label->setString(
+				fmt::format(
+					"{} ({})",
+					oldIDName, remapObj->m_groupID
+				).c_str()
+			);
+
+			auto buttonLabelPos = newButtonSprite->m_label->getPosition();
+			auto newNameLabel = CCLabelBMFont::create(
+				fmt::format("{} ({})", newIDName, remapObj->m_chance).c_str(),
+				"bigFont.fnt"
+			);
+			newNameLabel->limitLabelWidth(48.f, .35f, .1f);
+			newButtonSprite->m_label->limitLabelWidth(48.f, .35f, .1f);
+			newButtonSprite->m_label->setPositionY(buttonLabelPos.y + 4.f);
+			newNameLabel->setPosition({ buttonLabelPos.x, buttonLabelPos.y - 6.f });
+			newButtonSprite->addChild(newNameLabel);
+		}
+
+		auto newButton = CCMenuItemSpriteExtra::create(
+			newButtonSprite,
+			nullptr,
+			this,
+			menu_selector(NIDSetupSpawnPopup::onSelectNewRemap)
+		);
+		newButton->setTag(idx);
+		m_fields->m_remaps_list_menu->addChild(newButton);
+
+		static_cast<CCArray*>(this->m_pageContainers->objectAtIndex(1))->addObject(newButton);
+		static_cast<CCArray*>(this->m_groupContainers->objectAtIndex(0))->addObject(newButton);
+
+		return newButton;
+	}
+
+	void removeRemapButton(CCMenuItemSpriteExtra* button)
+	{
+		static_cast<CCArray*>(this->m_pageContainers->objectAtIndex(1))->removeObject(button);
+		static_cast<CCArray*>(this->m_groupContainers->objectAtIndex(0))->removeObject(button);
+
+		button->removeFromParent();
+	}
+
 
 	void onSelectNewRemap(CCObject* sender)
 	{
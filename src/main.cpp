@@ -1,34 +1,64 @@
 #include <Geode/loader/ModEvent.hpp>
 
 #include "globals.hpp"
+#include "AutoNameIndex.hpp"
 
 using namespace geode::prelude;
 
+// auto-naming runs for every ID of every pasted object, so the format is only parsed here
+static void updateBuildHelperNameFormat(std::string&& rawNameFormat)
+{
+	auto nameFormatRes = ng::parser::NameFormat::compile(rawNameFormat);
+
+	if (nameFormatRes.isOk())
+	{
+		ng::globals::g_buildHelperNameFormat = std::move(nameFormatRes.unwrap());
+		ng::globals::g_buildHelperNameFormatError.clear();
+	}
+	else
+	{
+		ng::globals::g_buildHelperNameFormat = {};
+		ng::globals::g_buildHelperNameFormatError = nameFormatRes.unwrapErr();
+	}
+
+	ng::globals::g_buildHelperRawNameFormat = std::move(rawNameFormat);
+
+	// the suffixes in use were read with the old format
+	ng::types::AutoNameIndex::get().invalidate();
+}
+
 $on_mod(Loaded)
 {
 	ng::globals::g_isEditorIDAPILoaded = Loader::get()->isModLoaded("cvolton.level-id-api");
 	ng::globals::g_isBetterEditLoaded = Loader::get()->isModLoaded("hjfod.betteredit");
 	// ng::globals::g_isImprovedGroupViewLoaded = Loader::get()->isModLoaded("alphalaneous.improved_group_view");
 
-	ng::globals::g_buildHelperRawNameFormat = Mod::get()->getSettingValue<std::string>("auto-name-format");
+	updateBuildHelperNameFormat(Mod::get()->getSettingValue<std::string>("auto-name-format"));
 
-	{
-		std::string rawNameFormat = ng::globals::g_buildHelperRawNameFormat;
+	ng::globals::g_labelRefreshBudget = Mod::get()->getSettingValue<double>("label-refresh-budget");
 
-		std::string nameFormat;
-		nameFormat = rawNameFormat.replace(rawNameFormat.find("{name}"), 6, "{}");
-		nameFormat = nameFormat.replace(nameFormat.find("{id}"), 4, "{}");
+	geode::listenForSettingChanges<double>("label-refresh-budget", [](double value) {
+		ng::globals::g_labelRefreshBudget = value;
+	});
 
-		ng::globals::g_buildHelperNameFormat = std::move(nameFormat);
-	}
+	ng::globals::g_labelLODZoom = Mod::get()->getSettingValue<double>("label-lod-zoom");
 
-	geode::listenForSettingChanges<std::string>("auto-name-format", [](std::string value) {
-		ng::globals::g_buildHelperRawNameFormat = value;
+	geode::listenForSettingChanges<double>("label-lod-zoom", [](double value) {
+		ng::globals::g_labelLODZoom = value;
+	});
 
-		std::string nameFormat;
-		nameFormat = value.replace(value.find("{name}"), 6, "{}");
-		nameFormat = nameFormat.replace(nameFormat.find("{id}"), 4, "{}");
+	ng::globals::g_useTrigramSearch = Mod::get()->getSettingValue<bool>("trigram-search");
+	ng::globals::g_trigramSearchMinSize = Mod::get()->getSettingValue<std::int64_t>("trigram-search-min-size");
 
-		ng::globals::g_buildHelperNameFormat = std::move(nameFormat);
+	geode::listenForSettingChanges<bool>("trigram-search", [](bool value) {
+		ng::globals::g_useTrigramSearch = value;
+	});
+
+	geode::listenForSettingChanges<std::int64_t>("trigram-search-min-size", [](std::int64_t value) {
+		ng::globals::g_trigramSearchMinSize = value;
+	});
+
+	geode::listenForSettingChanges<std::string>("auto-name-format", [](std::string value) {
+		updateBuildHelperNameFormat(std::move(value));
 	});
 }
@@ -53,99 +53,116 @@ geode::Result<Tokens> ng::parser::parseFormat(const std::string_view format)
 	return geode::Ok(tokens);
 }
 
-geode::Result<FormatPair> ng::parser::extract(const std::string& str, const Tokens& tokens)
+geode::Result<NameFormat> NameFormat::compile(const std::string_view format)
 {
-	FormatPair res;
-	std::size_t pos = 0;
+	auto tokensRes = parseFormat(format);
+	if (tokensRes.isErr())
+		return geode::Err(tokensRes.unwrapErr());
 
-	for (std::size_t i = 0; i < tokens.size(); i++)
+	NameFormat ret;
+	auto& tokens = tokensRes.unwrap();
+
+	ret.m_segments.reserve(tokens.size());
+
+	for (const Token& token : tokens)
 	{
-		const Token& token = tokens[i];
+		Segment segment{ token.type };
 
 		if (token.type == TokenType::LITERAL)
 		{
-			const std::string& lit = token.value;
-			if (str.substr(pos, lit.size()) != lit)
-				return geode::Err("Literal {} not found in input", lit);
-
-			pos += lit.size();
+			segment.offset = ret.m_literals.size();
+			segment.length = token.value.size();
+			ret.m_literals += token.value;
 		}
-		else
-		{
-			std::string nextLiteral;
-			std::size_t nextLiteralPos = i + 1;
-			while (nextLiteralPos < tokens.size())
+
+		ret.m_segments.push_back(segment);
+	}
+
+	for (std::size_t i = 0; i < ret.m_segments.size(); i++)
+	{
+		auto& segment = ret.m_segments[i];
+		segment.nextLiteral = ret.m_segments.size();
+
+		if (segment.type == TokenType::LITERAL) continue;
+
+		for (std::size_t next = i + 1; next < ret.m_segments.size(); next++)
+			if (ret.m_segments[next].type == TokenType::LITERAL)
 			{
-				if (tokens[nextLiteralPos].type == TokenType::LITERAL)
-				{
-					nextLiteral = tokens[nextLiteralPos].value;
-					break;
-				}
-				nextLiteralPos++;
+				segment.nextLiteral = next;
+				break;
 			}
+	}
 
-			std::string value;
-			if (nextLiteral.empty())
-			{
-				if (pos > str.size())
-					return geode::Err("Input too short");
+	return geode::Ok(std::move(ret));
+}
 
-				value = str.substr(pos);
-				pos = str.size();
-			}
-			else
-			{
-				std::size_t found = str.find(nextLiteral, pos);
+std::optional<NameFormat::Parts> NameFormat::extract(const std::string_view str) const
+{
+	Parts res;
+	std::size_t pos = 0;
 
-				if (found == std::string::npos)
-					return geode::Err("Next literal '{}' not found", nextLiteral);
+	for (const Segment& segment : m_segments)
+	{
+		if (segment.type == TokenType::LITERAL)
+		{
+			const auto lit = getLiteral(segment);
+			if (str.substr(pos, lit.size()) != lit)
+				return std::nullopt;
 
-				value = str.substr(pos, found - pos);
-				pos = found;
-			}
+			pos += lit.size();
+			continue;
+		}
 
-			if (token.type == TokenType::NAME)
-				res.name = value;
-			else
-				res.id = value;
+		std::string_view value;
+		if (segment.nextLiteral == m_segments.size())
+		{
+			value = str.substr(pos);
+			pos = str.size();
 		}
+		else
+		{
+			std::size_t found = str.find(getLiteral(m_segments[segment.nextLiteral]), pos);
+
+			if (found == std::string_view::npos)
+				return std::nullopt;
+
+			value = str.substr(pos, found - pos);
+			pos = found;
+		}
+
+		if (segment.type == TokenType::NAME)
+			res.name = value;
+		else
+			res.id = value;
 	}
 
 	if (pos != str.size())
-		return geode::Err("Input not fully consumed");
+		return std::nullopt;
 
-	return geode::Ok(res);
+	return res;
 }
 
-geode::Result<std::string> ng::parser::format(const Tokens& tokens, const FormatPair& fmtPair)
+std::string_view NameFormat::format(const std::string_view name, const std::string_view id, std::string& buffer) const
 {
-	std::string output;
-	for (const Token& token : tokens)
+	buffer.clear();
+
+	for (const Segment& segment : m_segments)
 	{
-		switch (token.type)
+		switch (segment.type)
 		{
 			case TokenType::LITERAL:
-				output += token.value;
+				buffer += getLiteral(segment);
 			break;
 
 			case TokenType::NAME:
-				output += fmtPair.name;
+				buffer += name;
 			break;
 
 			case TokenType::ID:
-				output += fmtPair.id;
+				buffer += id;
 			break;
 		}
 	}
 
-	return geode::Ok(output);
-}
-
-geode::Result<std::string> ng::parser::format(const std::string_view format, const FormatPair& fmtPair)
-{
-	auto tokensRes = parseFormat(format);
-	if (tokensRes.isErr())
-		return geode::Err(tokensRes.unwrapErr());
-
-	return ::format(tokensRes.unwrap(), fmtPair);
+	return buffer;
 }
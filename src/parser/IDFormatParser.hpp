@@ -3,6 +3,7 @@
 #include <string>
 #include <string_view>
 #include <vector>
+#include <optional>
 
 namespace ng::parser
 {
@@ -19,16 +20,47 @@ namespace ng::parser
 		std::string value;
 	};
 
-	struct FormatPair
-	{
-		std::string name;
-		std::string id;
-	};
-
 	using Tokens = std::vector<Token>;
 
 	geode::Result<Tokens> parseFormat(const std::string_view format);
-	geode::Result<FormatPair> extract(const std::string& str, const Tokens& tokens);
-	geode::Result<std::string> format(const Tokens& tokens, const FormatPair& fmtPair);
-	geode::Result<std::string> format(const std::string_view format, const FormatPair& fmtPair);
+
+	// a parsed name format, matched against and filled in without allocating
+	class NameFormat
+	{
+	public:
+		// views into the matched string
+		struct Parts
+		{
+			std::string_view name;
+			std::string_view id;
+		};
+
+		static geode::Result<NameFormat> compile(const std::string_view format);
+
+		NameFormat() = default;
+
+		std::optional<Parts> extract(const std::string_view str) const;
+		// fills the buffer in (reusing its capacity) and returns a view of it
+		std::string_view format(const std::string_view name, const std::string_view id, std::string& buffer) const;
+
+		explicit operator bool() const { return !m_segments.empty(); }
+
+	private:
+		struct Segment
+		{
+			TokenType type;
+			// literal's text in m_literals
+			std::size_t offset = 0;
+			std::size_t length = 0;
+			// placeholders end where the next literal begins, or at the end of the string without one
+			std::size_t nextLiteral = 0;
+		};
+
+		std::string_view getLiteral(const Segment& segment) const { return std::string_view{ m_literals }.substr(segment.offset, segment.length); }
+
+	private:
+		// offsets instead of views, so copies don't point into another format's string
+		std::string m_literals;
+		std::vector<Segment> m_segments;
+	};
 }
@@ -1,10 +1,76 @@
 #include "AutofillNamedIDsPreview.hpp"
 #include <NIDManager.hpp>
 #include "cells/NamedIDCell.hpp"
-#include "fuzzy_match.hpp"
+#include "NIDSearchIndex.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 using namespace geode::prelude;
 
+static std::unordered_map<std::uint32_t, Ref<NamedIDCell<true>>>& cellPool()
+{
+	static auto* pool = new std::unordered_map<std::uint32_t, Ref<NamedIDCell<true>>>();
+
+	return *pool;
+}
+
+// runs the searches off the main thread, one at a time
+class SearchWorker
+{
+public:
+	static SearchWorker& get()
+	{
+		// never destroyed, joining the thread while the mod is being unloaded can deadlock
+		static auto* instance = new SearchWorker();
+
+		return *instance;
+	}
+
+	// replaces the search waiting to run, if any, it was cancelled by the newer one anyway
+	void post(std::function<void()>&& search)
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_pending = std::move(search);
+		}
+		m_cv.notify_one();
+	}
+
+private:
+	SearchWorker()
+	{
+		std::thread(&SearchWorker::loop, this).detach();
+	}
+
+	void loop()
+	{
+		while (true)
+		{
+			std::function<void()> search;
+
+			{
+				std::unique_lock lock(m_mutex);
+				m_cv.wait(lock, [this] { return static_cast<bool>(m_pending); });
+
+				search = std::move(m_pending);
+				m_pending = nullptr;
+			}
+
+			search();
+		}
+	}
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::function<void()> m_pending;
+};
+
 AutofillNamedIDsPreview* AutofillNamedIDsPreview::create(NID nid, const std::string_view query)
 {
 	auto ret = new AutofillNamedIDsPreview();
@@ -20,6 +86,22 @@ AutofillNamedIDsPreview* AutofillNamedIDsPreview::create(NID nid, const std::str
 	return ret;
 }
 
+AutofillNamedIDsPreview* AutofillNamedIDsPreview::get()
+{
+	// never destroyed, releasing nodes while the game is shutting down can crash
+	static auto* instance = new Ref<AutofillNamedIDsPreview>(create(NID::GROUP, ""));
+
+	return *instance;
+}
+
+void AutofillNamedIDsPreview::prewarm()
+{
+	// pooled cells of the previous editor session show its colors
+	cellPool().clear();
+
+	get()->updateList(NID::GROUP, "");
+}
+
 bool AutofillNamedIDsPreview::init(NID nid, const std::string_view query)
 {
 	if (!CCLayer::init()) return false;
@@ -71,6 +153,8 @@ bool AutofillNamedIDsPreview::init(NID nid, const std::string_view query)
 
 void AutofillNamedIDsPreview::attachToInput(geode::TextInput* input)
 {
+	m_input = WeakRef<geode::TextInput>(input);
+
 	CCPoint inputWorldPos = input->getParent()->convertToWorldSpace(input->getPosition());
 
 	const CCSize& screenSize = CCDirector::sharedDirector()->getWinSize();
@@ -115,55 +199,175 @@ void AutofillNamedIDsPreview::show()
 
 void AutofillNamedIDsPreview::updateList(const std::string_view query)
 {
+	cancelSearch();
+
+	m_query = query;
+
+	const auto index = ng::types::NIDSearchIndex::get(m_ids_type);
+	const std::atomic_bool cancelled = false;
+
+	applyResults(*index, m_query, *rankResults(*index, m_query, cancelled));
+}
+
+void AutofillNamedIDsPreview::updateList(NID nid, const std::string_view query)
+{
+	m_ids_type = nid;
+	m_query = query;
+
+	updateList(m_query);
+
+	m_list->moveToTop();
+}
+
+void AutofillNamedIDsPreview::queueUpdate(NID nid, const std::string_view query)
+{
+	// a search that finishes before the debounce fires would show results for the previous query
+	cancelSearch();
+
+	m_ids_type = nid;
 	m_query = query;
 
+	// keystrokes coming in before it fires only move it back
+	this->unschedule(schedule_selector(AutofillNamedIDsPreview::onSearchDebounce));
+	this->scheduleOnce(schedule_selector(AutofillNamedIDsPreview::onSearchDebounce), SEARCH_DEBOUNCE);
+}
+
+void AutofillNamedIDsPreview::onSearchDebounce(float)
+{
+	cancelSearch();
+
+	// the index reads the Named IDs, so it must be fetched on the main thread
+	auto index = ng::types::NIDSearchIndex::get(m_ids_type);
+	auto token = std::make_shared<std::atomic_bool>(false);
+	m_search_token = token;
+
+	SearchWorker::get().post([self = WeakRef<AutofillNamedIDsPreview>(this), index = std::move(index), nid = m_ids_type, query = m_query, token = std::move(token)] {
+		auto results = rankResults(*index, query, *token);
+		if (!results) return;
+
+		Loader::get()->queueInMainThread([self, index, nid, query, token, results = std::move(*results)] {
+			auto preview = self.lock();
+
+			// a newer search was started, or the preview was closed
+			if (*token || !preview) return;
+			// the query changed since, its own search is queued
+			if (preview->m_ids_type != nid || preview->m_query != query) return;
+
+			preview->applyResults(*index, query, results);
+			preview->m_list->moveToTop();
+		});
+	});
+}
+
+void AutofillNamedIDsPreview::cancelSearch()
+{
+	if (m_search_token)
+	{
+		*m_search_token = true;
+		m_search_token.reset();
+	}
+}
+
+std::optional<std::vector<std::uint32_t>> AutofillNamedIDsPreview::rankResults(
+	const ng::types::NIDSearchIndex& index, const std::string_view query,
+	const std::atomic_bool& cancelled
+) {
+	// how many entries are scored between cancellation checks
+	static constexpr std::uint32_t CANCEL_CHECK_INTERVAL = 256;
+
+	const auto& entries = index.getEntries();
+	std::vector<std::uint32_t> results;
+
+	if (query.empty())
+	{
+		// nothing to rank by, show the lowest IDs
+		for (std::uint32_t idx = 0; idx < entries.size() && idx < MAX_RESULTS; idx++)
+			results.push_back(idx);
+
+		return results;
+	}
+
+	const ng::types::NIDSearchIndex::Query preparedQuery{ query };
+	std::vector<std::pair<double, std::uint32_t>> ranked;
+
+	for (std::uint32_t idx = 0; idx < entries.size(); idx++)
+	{
+		if (idx % CANCEL_CHECK_INTERVAL == 0 && cancelled)
+			return std::nullopt;
+
+		if (double score; ng::types::NIDSearchIndex::matches(preparedQuery, entries[idx], score))
+			ranked.emplace_back(score, idx);
+	}
+
+	// best score first, lower ID first on ties (entries are sorted by ID)
+	const auto topCount = std::min<std::size_t>(ranked.size(), MAX_RESULTS);
+	std::partial_sort(
+		ranked.begin(), ranked.begin() + topCount, ranked.end(),
+		[](const auto& a, const auto& b) { return a.first != b.first ? a.first > b.first : a.second < b.second; }
+	);
+
+	results.reserve(topCount);
+	for (std::size_t i = 0; i < topCount; i++)
+		results.push_back(ranked[i].second);
+
+	return results;
+}
+
+void AutofillNamedIDsPreview::applyResults(
+	const ng::types::NIDSearchIndex& index, const std::string_view query, const std::vector<std::uint32_t>& results
+) {
+	const auto& entries = index.getEntries();
+	const ng::types::NIDSearchIndex::Query preparedQuery{ query };
+
 	m_list->m_contentLayer->removeAllChildren();
+
+	std::array<std::uint8_t, 256> indices{};
+	bool bg = false;
+
+	for (auto idx : results)
 	{
-		const auto& namedIDs = NIDManager::getMutNamedIDs(m_ids_type);
+		const auto& entry = entries[idx];
 
-		std::vector<std::pair<std::string, short>> elements{ namedIDs.begin(), namedIDs.end() };
-		std::sort(elements.begin(), elements.end(), [](auto& a, auto& b) { return a.second < b.second; });
+		// only the shown names need their matched characters
+		indices.fill(0u);
+		if (!query.empty())
+			ng::types::NIDSearchIndex::matches(preparedQuery, entry, indices);
 
-		std::array<std::uint8_t, 256> indices{};
-		bool bg = false;
-		const bool queryEmpty = m_query.empty();
+		auto item = getPooledCell(entry);
 
-		for (auto& [name, id] : elements)
-		{
-			indices.fill(0u);
-
-			if (!queryEmpty && !ng::utils::fuzzy_match::matchesQuery(m_query, { name, id }, indices))
-				continue;
-
-			auto item = [&] {
-				if (auto cell = m_cells.find(id); cell != m_cells.end()) return cell->second.data();
-				auto cell = NamedIDCell<true>::create(m_ids_type, id, std::move(name), PREVIEW_SIZE.width);
-				m_cells.insert({ id, cell });
-				return cell;
-			}();
-
-			item->setDefaultBGColor({ 0, 0, 0, static_cast<GLubyte>(bg ? 60 : 20) });
-			item->setSelectCallback([&](NID nid, short id) {
-				this->selectCallback(nid, id);
-			});
-			item->highlightQuery(m_query, indices);
-			m_list->m_contentLayer->addChild(item);
-
-			bg = !bg;
-		}
+		item->setDefaultBGColor({ 0, 0, 0, static_cast<GLubyte>(bg ? 60 : 20) });
+		item->setSelectCallback([&](NID nid, short id) {
+			this->selectCallback(nid, id);
+		});
+		item->highlightQuery(query, indices);
+		m_list->m_contentLayer->addChild(item);
+
+		bg = !bg;
 	}
 
 	m_list->m_contentLayer->updateLayout();
 }
 
-void AutofillNamedIDsPreview::updateList(NID nid, const std::string_view query)
+NamedIDCell<true>* AutofillNamedIDsPreview::getPooledCell(const ng::types::NIDSearchIndex::Entry& entry)
 {
-	m_ids_type = nid;
-	m_query = query;
+	auto& pool = cellPool();
+	const auto key = static_cast<std::uint32_t>(static_cast<std::uint8_t>(entry.nid)) << 16
+		| static_cast<std::uint16_t>(entry.id);
 
-	updateList(m_query);
+	if (auto it = pool.find(key); it != pool.end() && it->second->getName() == entry.name)
+	{
+		it->second->refreshColor();
+		return it->second;
+	}
 
-	m_list->moveToTop();
+	// cells still in a list are kept alive by it
+	if (pool.size() >= MAX_POOLED_CELLS)
+		pool.clear();
+
+	auto cell = NamedIDCell<true>::create(entry.nid, entry.id, std::string{ entry.name }, PREVIEW_SIZE.width);
+	pool[key] = cell;
+
+	return cell;
 }
 
 void AutofillNamedIDsPreview::keyBackClicked()
@@ -184,6 +388,8 @@ void AutofillNamedIDsPreview::onEnterTransitionDidFinish()
 
 void AutofillNamedIDsPreview::onExit()
 {
+	cancelSearch();
+
 	auto TD = CCTouchDispatcher::get();
 
 	TD->unregisterForcePrio(this);
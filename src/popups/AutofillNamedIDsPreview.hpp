@@ -1,10 +1,16 @@
 #pragma once
 
 #include "cells/NamedIDCell.hpp"
+#include <atomic>
+#include <memory>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include <NIDEnum.hpp>
 
+#include "NIDSearchIndex.hpp"
+
 #include <Geode/ui/TextInput.hpp>
 
 #include <Geode/cocos/layers_scenes_transitions_nodes/CCLayer.h>
@@ -14,16 +20,24 @@ class AutofillNamedIDsPreview : public cocos2d::CCLayer
 {
 public:
 	static AutofillNamedIDsPreview* create(NID, const std::string_view);
+	// the dropdown every AutofillInput shares, added to the running scene when shown
+	static AutofillNamedIDsPreview* get();
+	// builds the shared dropdown, the group search index and the cells of the first results,
+	// so the first keystroke in the editor doesn't have to
+	static void prewarm();
 
 protected:
 	bool init(NID, const std::string_view);
 
 public:
 	void attachToInput(geode::TextInput*);
+	bool isAttachedTo(geode::TextInput* input) const { return m_input.lock().data() == input; }
 	void show();
 
 	void updateList(NID, const std::string_view);
 	void updateList(const std::string_view);
+	// like updateList, but debounced and searched off the main thread
+	void queueUpdate(NID, const std::string_view);
 
 	virtual void keyBackClicked() override;
 	virtual void onEnterTransitionDidFinish() override;
@@ -36,16 +50,36 @@ public:
 private:
 	void selectCallback(NID, short);
 
+	void onSearchDebounce(float);
+	void cancelSearch();
+
+	// nullopt if cancelled, safe to call from any thread
+	static std::optional<std::vector<std::uint32_t>> rankResults(const ng::types::NIDSearchIndex&, const std::string_view, const std::atomic_bool&);
+	// results of ranking the index by the query
+	void applyResults(const ng::types::NIDSearchIndex&, const std::string_view, const std::vector<std::uint32_t>&);
+
+	// cells are shared by every dropdown and reused until their Named ID is renamed
+	static NamedIDCell<true>* getPooledCell(const ng::types::NIDSearchIndex::Entry&);
+
 private:
 	static constexpr cocos2d::CCSize PREVIEW_SIZE{ 190.f, 110.f };
 	static constexpr cocos2d::CCSize SCROLL_LAYER_SIZE{ 168.f, 92.f };
+	// best matches shown in the dropdown, the full list is in NamedIDsPopup
+	static constexpr std::size_t MAX_RESULTS = 25;
+	// keystrokes closer together than this (in seconds) only trigger one search
+	static constexpr float SEARCH_DEBOUNCE = .03f;
+	// the pool is emptied once it holds this many cells
+	static constexpr std::size_t MAX_POOLED_CELLS = 512;
 
 	NID m_ids_type;
 	std::string m_query;
+	// set once a newer search makes the running one pointless
+	std::shared_ptr<std::atomic_bool> m_search_token;
+	// input the dropdown was last attached to, weak so a new input at the same address isn't mistaken for it
+	geode::WeakRef<geode::TextInput> m_input;
 
 
 	std::function<void(NID, short)> m_select_callback;
-	std::unordered_map<short, geode::Ref<NamedIDCell<true>>> m_cells;
 
 
 	cocos2d::extension::CCScale9Sprite* m_bg_sprite;
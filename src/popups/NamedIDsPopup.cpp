@@ -2,6 +2,8 @@
 
 #include <vector>
 #include <algorithm>
+#include <numeric>
+#include <unordered_set>
 
 #include "AddNamedIDPopup.hpp"
 #include "SelectIDFilterPopup.hpp"
@@ -12,7 +14,10 @@
 
 #include "utils.hpp"
 #include "globals.hpp"
-#include "fuzzy_match.hpp"
+#include "constants.hpp"
+#include "NIDSearchIndex.hpp"
+#include "DescriptionIndex.hpp"
+#include "RecyclingList.hpp"
 
 using namespace geode::prelude;
 
@@ -79,14 +84,14 @@ bool NamedIDsPopup::init(bool readOnly)
 
 	auto addButtonSpr = CCSprite::create("plus.png"_spr);
 	addButtonSpr->setScale(.4f);
-	auto addButton = CCMenuItemSpriteExtra::create(
+	m_add_button = CCMenuItemSpriteExtra::create(
 		addButtonSpr,
 		this,
 		menu_selector(NamedIDsPopup::onAddButton)
 	);
-	addButton->setEnabled(!readOnly);
-	addButton->setColor(readOnly ? ccColor3B{ 125, 125, 125 } : ccColor3B{ 255, 255, 255 });
-	this->m_buttonMenu->addChildAtPosition(addButton, Anchor::TopRight, { -49.f, -20.f });
+	m_add_button->setEnabled(!readOnly);
+	m_add_button->setColor(readOnly ? ccColor3B{ 125, 125, 125 } : ccColor3B{ 255, 255, 255 });
+	this->m_buttonMenu->addChildAtPosition(m_add_button, Anchor::TopRight, { -49.f, -20.f });
 
 	auto shareButtonSpr = CCSprite::createWithSpriteFrameName("GJ_shareBtn_001.png");
 	shareButtonSpr->setScale(.48f);
@@ -107,8 +112,9 @@ bool NamedIDsPopup::init(bool readOnly)
 	m_search_container = CCMenu::create();
 	m_search_container->setContentSize({ SCROLL_LAYER_SIZE.width, 30.f });
 	m_search_input = geode::TextInput::create(
-		(SCROLL_LAYER_SIZE.width - 15.f) / .7f - 40.f,
-		fmt::format("Search {}s...", ng::utils::getNamedIDIndentifier(m_ids_type))
+		// make room for the description search toggle
+		(SCROLL_LAYER_SIZE.width - 15.f - (ng::globals::g_isEditorIDAPILoaded ? 25.f : .0f)) / .7f - 40.f,
+		getSearchPlaceholder(m_ids_type)
 	);
 	m_search_input->setTextAlign(TextInputAlign::Left);
 	m_search_input->setScale(.7f);
@@ -128,24 +134,36 @@ bool NamedIDsPopup::init(bool readOnly)
 	searchClearButton->setPosition({ 40.f, 40.f });
 	m_search_container->addChildAtPosition(searchClearButton, Anchor::Right, { -18.f, .0f });
 
-	m_layer_bg->addChildAtPosition(m_search_container, Anchor::Top, { .0f, -3.f }, { .5f, 1.f });
-
-	m_list = ScrollLayer::create(SCROLL_LAYER_SIZE - CCPoint{ .0f, m_search_container->getContentHeight() });
-	m_list->setTouchEnabled(true);
+	if (ng::globals::g_isEditorIDAPILoaded)
+	{
+		auto descriptionSearchSprOff = CCSprite::create("description.png"_spr);
+		auto descriptionSearchSprOn = CCSprite::create("descriptionToggled.png"_spr);
+		descriptionSearchSprOff->setScale(.65f);
+		descriptionSearchSprOn->setScale(.65f);
+		auto descriptionSearchButton = CCMenuItemToggler::create(
+			descriptionSearchSprOff,
+			descriptionSearchSprOn,
+			this,
+			menu_selector(NamedIDsPopup::onDescriptionSearchButton)
+		);
+		descriptionSearchButton->setID("description-search-button");
+		m_search_container->addChildAtPosition(descriptionSearchButton, Anchor::Right, { -48.f, .0f });
+	}
 
-	updateList(NID::GROUP);
+	m_layer_bg->addChildAtPosition(m_search_container, Anchor::Top, { .0f, -3.f }, { .5f, 1.f });
 
-	m_list->m_contentLayer->setLayout(
-		ColumnLayout::create()
-			->setAxisReverse(true)
-			->setAutoGrowAxis(m_list->getContentHeight())
-			->setCrossAxisOverflow(false)
-			->setAxisAlignment(AxisAlignment::End)
-			->setGap(.0f)
+	m_list = ng::types::RecyclingList::create(
+		SCROLL_LAYER_SIZE - CCPoint{ .0f, m_search_container->getContentHeight() },
+		ROW_HEIGHT,
+		[this] { return this->createCell(); },
+		[this](CCNode* cell, std::size_t row) { this->bindCell(static_cast<NamedIDCell<false>*>(cell), row); }
 	);
+	m_list->getScrollLayer()->setTouchEnabled(true);
+
+	updateState();
 	m_list->moveToTop();
 
-	const int buttonPrio = m_list->getTouchPriority() - 1;
+	const int buttonPrio = m_list->getScrollLayer()->getTouchPriority() - 1;
 	m_buttonMenu->setTouchPriority(buttonPrio);
 	m_search_container->setTouchPriority(buttonPrio);
 
@@ -155,7 +173,7 @@ bool NamedIDsPopup::init(bool readOnly)
 	listBorders->setContentSize(SCROLL_LAYER_SIZE + CCSize{ 5.f, .0f });
 	this->m_mainLayer->addChildAtPosition(listBorders, Anchor::Center, { .0f, -13.f });
 
-	auto scrollBar = geode::Scrollbar::create(m_list);
+	auto scrollBar = geode::Scrollbar::create(m_list->getScrollLayer());
 	this->m_mainLayer->addChildAtPosition(scrollBar, Anchor::Center, { m_layer_bg->getContentWidth() / 2.f + 10.f, -13.f });
 
 	return true;
@@ -175,14 +193,31 @@ void NamedIDsPopup::onClearSearchButton(CCObject*)
 	updateState();
 }
 
+void NamedIDsPopup::onDescriptionSearchButton(CCObject*)
+{
+	// the toggler flips its state after the callback
+	m_search_descriptions = !m_search_descriptions;
+
+	if (!m_search_input->getString().empty())
+	{
+		updateState();
+		m_list->moveToTop();
+	}
+}
+
 void NamedIDsPopup::onFilterButton(CCObject*)
 {
 	SelectIDFilterPopup::create(m_ids_type, [&](NID nid) {
 		this->m_ids_type = nid;
 
-		this->m_search_input->setPlaceholder(fmt::format("Search {}s...", ng::utils::getNamedIDIndentifier(nid)));
+		this->m_search_input->setPlaceholder(getSearchPlaceholder(nid));
 		this->m_search_input->setString("");
 
+		// there's no type to add a Named ID to
+		const bool canAdd = !m_read_only && nid != ng::constants::ALL_NIDS;
+		this->m_add_button->setEnabled(canAdd);
+		this->m_add_button->setColor(canAdd ? ccColor3B{ 255, 255, 255 } : ccColor3B{ 125, 125, 125 });
+
 		this->updateState();
 		this->m_list->moveToTop();
 	})->show();
@@ -199,8 +234,8 @@ void NamedIDsPopup::onSettingsButton(CCObject*)
 {
 	m_adv_mode = !m_adv_mode;
 
-	for (auto& item : CCArrayExt<NamedIDCell<false>*>(m_list->m_contentLayer->getChildren()))
-		item->showAdvancedOptions(m_adv_mode);
+	for (auto cell : m_list->getCells())
+		static_cast<NamedIDCell<false>*>(cell)->showAdvancedOptions(m_adv_mode);
 }
 
 void NamedIDsPopup::onShareButton(CCObject*)
@@ -210,53 +245,82 @@ void NamedIDsPopup::onShareButton(CCObject*)
 
 		this->updateState();
 		ng::utils::editor::save();
+		ng::utils::editor::refreshObjectLabels();
 	}, [](bool) {})->show();
 }
 
-void NamedIDsPopup::updateList(NID nid)
+void NamedIDsPopup::updateState()
 {
-	m_ids_type = nid;
+	auto query = m_search_input->getString();
+
+	const auto index = ng::types::NIDSearchIndex::get(m_ids_type);
+	// filled in next to the current rows, so they can be compared
+	auto& rows = m_next_rows;
+	rows.clear();
 
+	if (query.empty())
+	{
+		m_search.reset();
+
+		rows.resize(index->getEntries().size());
+		std::iota(rows.begin(), rows.end(), 0);
+	}
+	else
 	{
-		const auto namedIDs = NIDManager::getMutNamedIDs(m_ids_type);
+		std::unordered_set<std::uint32_t> described;
 
-		std::vector<std::pair<std::string, short>> elements{ namedIDs.begin(), namedIDs.end() };
-		std::sort(elements.begin(), elements.end(), [](auto& a, auto& b) { return a.second < b.second; });
+		// best description matches first, then the name matches that weren't among them
+		if (m_search_descriptions)
+			for (const auto& result : ng::types::DescriptionIndex::get().search(m_ids_type, query))
+			{
+				// descriptions outlive the names they were written for
+				auto idx = index->find(result.nid, result.id);
+				if (!idx) continue;
 
-		bool bg = false;
+				rows.push_back(*idx);
+				described.insert(*idx);
+			}
 
-		for (auto& [name, id] : elements)
+		for (auto idx : m_search.search(index, query))
 		{
-			auto item = NamedIDCell<false>::create(m_ids_type, id, std::move(name), m_adv_mode, m_read_only, SCROLL_LAYER_SIZE.width);
-			item->setDefaultBGColor({ 0, 0, 0, static_cast<GLubyte>(bg ? 60 : 20) });
-			m_list->m_contentLayer->addChild(item);
+			if (described.contains(idx)) continue;
 
-			bg = !bg;
+			rows.push_back(idx);
 		}
 	}
+
+	// same snapshot and same rows, every cell already shows the right Named ID
+	if (index == m_rows_index && rows == m_rows) return;
+
+	m_rows_index = index;
+	m_rows.swap(rows);
+
+	// cells whose row still shows the same Named ID skip rebinding (see NamedIDCell<false>::bind)
+	m_list->setRowCount(m_rows.size());
 }
 
-void NamedIDsPopup::updateState()
+NamedIDCell<false>* NamedIDsPopup::createCell()
 {
-	auto query = m_search_input->getString();
+	auto cell = NamedIDCell<false>::create(NID::GROUP, 0, "", m_adv_mode, m_read_only, SCROLL_LAYER_SIZE.width);
+	// the row the cell was showing may have moved or disappeared
+	cell->setChangeCallback([this](NID, short) { this->updateState(); });
 
-	m_list->m_contentLayer->removeAllChildren();
-	updateList(m_ids_type);
+	return cell;
+}
 
-	if (!query.empty() && !NIDManager::getMutNamedIDs(m_ids_type).empty())
-	{
-		bool bg = false;
+void NamedIDsPopup::bindCell(NamedIDCell<false>* cell, std::size_t row)
+{
+	const auto& entry = m_rows_index->getEntries()[m_rows[row]];
 
-		for (auto& item : CCArrayExt<NamedIDCell<false>*>(m_list->m_contentLayer->getChildren()->shallowCopy()))
-		{
-			item->setDefaultBGColor({ 0, 0, 0, static_cast<GLubyte>(bg ? 60 : 20) });
+	cell->bind(entry.nid, entry.id, entry.name);
+	cell->setDefaultBGColor({ 0, 0, 0, static_cast<GLubyte>(row % 2 ? 60 : 20) });
+	cell->showIDType(m_ids_type == ng::constants::ALL_NIDS);
+}
 
-			if (!ng::utils::fuzzy_match::matchesQuery(query, { item->getName(), item->getID() }))
-				item->removeFromParent();
-			else
-				bg = !bg;
-		}
-	}
+std::string NamedIDsPopup::getSearchPlaceholder(NID nid)
+{
+	if (nid == ng::constants::ALL_NIDS)
+		return "Search all Named IDs...";
 
-	m_list->m_contentLayer->updateLayout();
+	return fmt::format("Search {}s...", ng::utils::getNamedIDIndentifier(nid));
 }
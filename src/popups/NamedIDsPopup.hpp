@@ -1,9 +1,21 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include <Geode/ui/Popup.hpp>
 
 #include <NIDEnum.hpp>
 
+#include "NIDSearchIndex.hpp"
+#include "RecyclingList.hpp"
+
+template <bool SHORT>
+class NamedIDCell;
+template <>
+class NamedIDCell<false>;
+
 class NamedIDsPopup : public geode::Popup
 {
 public:
@@ -16,24 +28,40 @@ public:
 	virtual void onClose(cocos2d::CCObject*) override;
 
 	void onClearSearchButton(cocos2d::CCObject*);
+	void onDescriptionSearchButton(cocos2d::CCObject*);
 	void onFilterButton(cocos2d::CCObject*);
 	void onAddButton(cocos2d::CCObject*);
 	void onSettingsButton(cocos2d::CCObject*);
 	void onShareButton(cocos2d::CCObject*);
 
-	void updateList(NID);
 	void updateState();
 
+private:
+	NamedIDCell<false>* createCell();
+	void bindCell(NamedIDCell<false>*, std::size_t);
+
+	static std::string getSearchPlaceholder(NID);
+
 private:
 	static constexpr cocos2d::CCSize SCROLL_LAYER_SIZE{ 260.f, 215.f };
+	static constexpr float ROW_HEIGHT = 30.f;
 
 	NID m_ids_type = NID::GROUP;
 
 	bool m_adv_mode = false;
 	bool m_read_only = false;
+	// also match the query against descriptions
+	bool m_search_descriptions = false;
+
+	ng::types::IncrementalSearch m_search;
+	// the list shows m_rows_index' entries at these indices
+	std::shared_ptr<const ng::types::NIDSearchIndex> m_rows_index;
+	std::vector<std::uint32_t> m_rows;
+	std::vector<std::uint32_t> m_next_rows;
 
+	CCMenuItemSpriteExtra* m_add_button;
 	cocos2d::CCLayerColor* m_layer_bg;
 	cocos2d::CCMenu* m_search_container;
 	geode::TextInput* m_search_input;
-	geode::ScrollLayer* m_list;
+	ng::types::RecyclingList* m_list;
 };
@@ -3,6 +3,7 @@
 #include <NIDManager.hpp>
 
 #include "utils.hpp"
+#include "constants.hpp"
 #include "operators.hpp"
 
 using namespace geode::prelude;
@@ -24,7 +25,7 @@ SelectIDFilterPopup* SelectIDFilterPopup::create(NID currentNid, std::function<v
 
 bool SelectIDFilterPopup::init(NID currentNid, std::function<void(NID)>&& onChangedCallback)
 {
-	if (!Popup::init(220.f, 130.f))
+	if (!Popup::init(220.f, 150.f))
 		return false;
 
 	m_on_changed_callback = std::move(onChangedCallback);
@@ -33,7 +34,7 @@ bool SelectIDFilterPopup::init(NID currentNid, std::function<void(NID)>&& onChan
 	this->setTitle("Filter Named IDs");
 
 	m_toggles_menu = CCMenu::create();
-	m_toggles_menu->setContentSize({ 200.f, 75.f });
+	m_toggles_menu->setContentSize({ 200.f, 95.f });
 	m_toggles_menu->setLayout(
 		ColumnLayout::create()
 			->setAutoScale(true)
@@ -45,12 +46,12 @@ bool SelectIDFilterPopup::init(NID currentNid, std::function<void(NID)>&& onChan
 			->setCrossAxisAlignment(AxisAlignment::Between)
 			->setGap(10.f)
 	);
-	m_toggles_menu->setPosition({ 110.f, 55.f });
+	m_toggles_menu->setPosition({ 110.f, 65.f });
 	this->m_buttonMenu->addChild(m_toggles_menu);
 
-	// skip NID::DYNAMIC_COUNTER_TIMER
-	for (NID nid = NID::GROUP; nid < NID::_INTERNAL_LAST - 1; nid = nid + 1)
-	{
+	std::size_t totalCount = 0;
+
+	auto addToggle = [&](NID nid, const std::string& text) {
 		auto toggleMenu = CCMenu::create();
 		toggleMenu->setContentSize({ 150.f, 50.f });
 		toggleMenu->setLayout(
@@ -76,10 +77,7 @@ bool SelectIDFilterPopup::init(NID currentNid, std::function<void(NID)>&& onChan
 		nidButton->toggle(nid == currentNid);
 		toggleMenu->addChild(nidButton);
 
-		auto nidLabel = CCLabelBMFont::create(
-			fmt::format("{} ({})", ng::utils::getNamedIDIndentifier(nid), NIDManager::getMutNamedIDs(nid).size()).c_str(),
-			"bigFont.fnt"
-		);
+		auto nidLabel = CCLabelBMFont::create(text.c_str(), "bigFont.fnt");
 		nidLabel->limitLabelWidth(100.f, 1.f, .1f);
 		toggleMenu->addChild(nidLabel);
 
@@ -87,8 +85,19 @@ bool SelectIDFilterPopup::init(NID currentNid, std::function<void(NID)>&& onChan
 		m_toggles_menu->addChild(toggleMenu);
 
 		nidLabel->setPositionY(nidLabel->getPositionY() + 2.f);
+	};
+
+	// skip NID::DYNAMIC_COUNTER_TIMER
+	for (NID nid = NID::GROUP; nid < NID::_INTERNAL_LAST - 1; nid = nid + 1)
+	{
+		const auto count = NIDManager::getMutNamedIDs(nid).size();
+		totalCount += count;
+
+		addToggle(nid, fmt::format("{} ({})", ng::utils::getNamedIDIndentifier(nid), count));
 	}
 
+	addToggle(ng::constants::ALL_NIDS, fmt::format("All types ({})", totalCount));
+
 	m_toggles_menu->updateLayout();
 
 	return true;
@@ -39,6 +39,7 @@ bool NamedIDCell<false>::init(
 	m_id_type = idType;
 	m_id = id;
 	m_name = std::move(name);
+	m_extras_generation = NIDExtrasManager::getGeneration(m_id_type);
 
 	m_bg = CCLayerColor::create({ 0, 0, 0, 0 });
 	m_bg->setContentSize({ width, 30.f });
@@ -57,24 +58,33 @@ bool NamedIDCell<false>::init(
 	m_name_label->setCascadeColorEnabled(true);
 	m_name_menu->addChild(m_name_label);
 
-	if (m_id_type == NID::COLOR)
+	m_type_label = CCLabelBMFont::create(
+		std::string{ ng::utils::getNamedIDIndentifier(m_id_type) }.c_str(),
+		"bigFont.fnt"
+	);
+	m_type_label->setScale(.3f);
+	m_type_label->setOpacity(150);
+	m_type_label->setID("id-type-label");
+	m_type_label->setVisible(false);
+	m_name_menu->addChild(m_type_label);
+
+	// created for every cell (but only shown for colors), cells can be rebound to another ID type
+	if (auto LEL = LevelEditorLayer::get())
 	{
-		if (auto LEL = LevelEditorLayer::get())
-		{
-			m_color_sprite = ColorChannelSprite::create();
-			m_color_sprite->setScale(.6f);
+		m_color_sprite = ColorChannelSprite::create();
+		m_color_sprite->setScale(.6f);
 
+		if (m_id_type == NID::COLOR)
 			// fake a call to colorSelectClosed to set visual data
 			colorSelectClosed(nullptr);
 
-			m_color_button = CCMenuItemSpriteExtra::create(
-				m_color_sprite,
-				this,
-				menu_selector(NamedIDCell<false>::onSelectColor)
-			);
-			m_color_button->setEnabled(!readOnly);
-			m_name_menu->addChild(m_color_button);
-		}
+		m_color_button = CCMenuItemSpriteExtra::create(
+			m_color_sprite,
+			this,
+			menu_selector(NamedIDCell<false>::onSelectColor)
+		);
+		m_color_button->setEnabled(!readOnly);
+		m_name_menu->addChild(m_color_button);
 	}
 
 	if (ng::globals::g_isEditorIDAPILoaded)
@@ -95,15 +105,6 @@ bool NamedIDCell<false>::init(
 		m_preview_button->setVisible(false);
 		m_name_menu->addChild(m_preview_button);
 
-		if (!NIDExtrasManager::getIsNamedIDPreviewed(m_id_type, m_id).unwrapOr(true))
-		{
-			m_preview_toggled = false;
-			previewToggledButtonSpr->setVisible(true);
-			previewButtonSpr->setVisible(false);
-
-			m_name_label->setColor({ 125, 125, 125});
-		}
-
 		auto descriptionButtonSpr = CCSprite::create("description.png"_spr);
 		descriptionButtonSpr->setScale(.65f);
 		m_description_button = CCMenuItemSpriteExtra::create(
@@ -111,11 +112,7 @@ bool NamedIDCell<false>::init(
 			this,
 			menu_selector(NamedIDCell<false>::onDescriptionButton)
 		);
-		m_description_button->setVisible(
-			NIDExtrasManager::getNamedIDDescription(m_id_type, m_id).isOkAnd(
-				[](const std::string& s) { return !s.empty(); }
-			) && !readOnly
-		);
+		m_description_button->setVisible(false);
 		m_name_menu->addChild(m_description_button);
 	}
 
@@ -178,14 +175,56 @@ bool NamedIDCell<false>::init(
 	m_button_menu->addChild(m_cancel_button);
 
 	m_name_menu->setContentWidth(this->getContentWidth() - m_button_menu->getContentWidth() - 25.f);
-	m_name_menu->updateLayout();
 	m_button_menu->updateLayout();
 
+	this->refreshPreviewState();
 	this->showAdvancedOptions(advMode);
 
 	return true;
 }
 
+void NamedIDCell<false>::bind(NID idType, short id, std::string_view name)
+{
+	const auto extrasGeneration = NIDExtrasManager::getGeneration(idType);
+
+	// already showing it, this also keeps an edit in progress going
+	if (idType == m_id_type && id == m_id && name == m_name && extrasGeneration == m_extras_generation)
+		return;
+
+	m_extras_generation = extrasGeneration;
+
+	if (m_editing)
+		cancelEditing();
+
+	const bool typeChanged = idType != m_id_type;
+
+	m_id_type = idType;
+	m_id = id;
+	if (m_name != name)
+		m_name = name;
+
+	m_name_label->setString(fmt::format("{}", m_id).c_str());
+	m_name_input->setString(m_name);
+
+	if (typeChanged)
+		m_type_label->setString(std::string{ ng::utils::getNamedIDIndentifier(m_id_type) }.c_str());
+
+	if (m_color_button && m_id_type == NID::COLOR)
+		colorSelectClosed(nullptr);
+
+	refreshPreviewState();
+	showAdvancedOptions(m_adv_mode);
+}
+
+void NamedIDCell<false>::showIDType(bool state)
+{
+	if (m_type_label->isVisible() == state) return;
+
+	m_type_label->setVisible(state);
+
+	m_name_menu->updateLayout();
+}
+
 void NamedIDCell<false>::setDefaultBGColor(const ccColor4B& color)
 {
 	m_bg_color = color;
@@ -194,23 +233,28 @@ void NamedIDCell<false>::setDefaultBGColor(const ccColor4B& color)
 	m_bg->setOpacity(m_bg_color.a);
 }
 
+void NamedIDCell<false>::cancelEditing()
+{
+	m_editing = false;
+
+	m_edit_button->getChildByID("toggled-sprite")->setVisible(false);
+	m_edit_button->getNormalImage()->setVisible(true);
+	m_cancel_button->setVisible(false);
+
+	m_name_input->setString(NIDManager::getNameForID(m_id_type, m_id).unwrapOr(""));
+	m_name_input->setEnabled(false);
+
+	if (g_currentEditingItem == this)
+		g_currentEditingItem = nullptr;
+}
+
 void NamedIDCell<false>::onEditButton(CCObject* sender)
 {
 	auto button = static_cast<CCMenuItemSpriteExtra*>(sender);
 	m_editing = !m_editing;
 
 	if (m_editing && g_currentEditingItem && g_currentEditingItem != this)
-	{
-		g_currentEditingItem->m_editing = false;
-		g_currentEditingItem->m_edit_button->getChildByID("toggled-sprite")->setVisible(false);
-		g_currentEditingItem->m_edit_button->getNormalImage()->setVisible(true);
-		g_currentEditingItem->m_cancel_button->setVisible(false);
-
-		g_currentEditingItem->m_name_input->setString(
-			NIDManager::getNameForID(m_id_type, g_currentEditingItem->m_id).unwrapOr("")
-		);
-		g_currentEditingItem->m_name_input->setEnabled(false);
-	}
+		g_currentEditingItem->cancelEditing();
 
 	button->getChildByID("toggled-sprite")->setVisible(m_editing);
 	button->getNormalImage()->setVisible(!m_editing);
@@ -265,7 +309,9 @@ void NamedIDCell<false>::onEditButton(CCObject* sender)
 
 	ng::utils::editor::refreshObjectLabels();
 
-	if (m_name_input->getString().empty())
+	if (m_on_change_cb)
+		m_on_change_cb(m_id_type, m_id);
+	else if (m_name_input->getString().empty())
 	{
 		CCNode* parent = this->getParent();
 		this->removeFromParent();
@@ -304,6 +350,18 @@ void NamedIDCell<false>::onPreviewButton(CCObject*)
 	m_name_label->setColor(m_preview_toggled ? ccColor3B{ 255, 255, 255 } : ccColor3B{ 125, 125, 125 });
 }
 
+void NamedIDCell<false>::refreshPreviewState()
+{
+	if (!ng::globals::g_isEditorIDAPILoaded) return;
+
+	m_preview_toggled = NIDExtrasManager::getIsNamedIDPreviewed(m_id_type, m_id).unwrapOr(true);
+
+	m_preview_button->getNormalImage()->setVisible(m_preview_toggled);
+	m_preview_button->getChildByID("toggled-sprite")->setVisible(!m_preview_toggled);
+
+	m_name_label->setColor(m_preview_toggled ? ccColor3B{ 255, 255, 255 } : ccColor3B{ 125, 125, 125 });
+}
+
 void NamedIDCell<false>::onDescriptionButton(CCObject*)
 {
 	EditDescriptionPopup::create(m_id_type, m_id)->show();
@@ -311,17 +369,20 @@ void NamedIDCell<false>::onDescriptionButton(CCObject*)
 
 void NamedIDCell<false>::showAdvancedOptions(bool state)
 {
-	if (!ng::globals::g_isEditorIDAPILoaded) return;
+	m_adv_mode = state;
 
-	m_preview_button->setVisible(state);
-	m_description_button->setVisible(
-		state || NIDExtrasManager::getNamedIDDescription(m_id_type, m_id).isOkAnd(
-			[](const std::string& s) { return !s.empty(); }
-		)
-	);
+	if (ng::globals::g_isEditorIDAPILoaded)
+	{
+		m_preview_button->setVisible(state);
+		m_description_button->setVisible(
+			state || NIDExtrasManager::getNamedIDDescription(m_id_type, m_id).isOkAnd(
+				[](const std::string& s) { return !s.empty(); }
+			)
+		);
+	}
 
 	if (m_color_button)
-		m_color_button->setVisible(!state);
+		m_color_button->setVisible(!state && m_id_type == NID::COLOR);
 
 	m_name_menu->updateLayout();
 }
@@ -409,43 +470,13 @@ bool NamedIDCell<true>::init(NID idType, short id, std::string&& name, float wid
 	m_name_label->setCascadeColorEnabled(true);
 	m_name_menu->addChild(m_name_label);
 
-	if (m_id_type == NID::COLOR)
+	if (m_id_type == NID::COLOR && LevelEditorLayer::get())
 	{
-		if (auto LEL = LevelEditorLayer::get())
-		{
-			m_color_sprite = ColorChannelSprite::create();
-			m_color_sprite->setScale(.6f);
-
-			auto effectManager = LevelEditorLayer::get()->m_levelSettings->m_effectManager;
-
-			if (!effectManager->colorExists(m_id))
-				m_color_sprite->updateValues(nullptr);
-
-			auto colAction = effectManager->getColorAction(m_id);
-			m_color_sprite->updateValues(colAction);
-
-			// this is safe since updateCopyLabel just modifies visual data
-			if (!m_color_sprite->m_copyLabel)
-				m_color_sprite->updateCopyLabel(1, false);
-
-			if (colAction->m_copyID == 0)
-			{
-				switch (colAction->m_playerColor)
-				{
-					case 1:
-					case 2:
-						m_color_sprite->m_copyLabel->setString(fmt::format("P{}", colAction->m_playerColor).c_str());
-						m_color_sprite->m_copyLabel->setVisible(true);
-						break;
-
-					default:
-						m_color_sprite->m_copyLabel->setVisible(false);
-						break;
-				}
-			}
-
-			m_name_menu->addChild(m_color_sprite);
-		}
+		m_color_sprite = ColorChannelSprite::create();
+		m_color_sprite->setScale(.6f);
+		refreshColor();
+
+		m_name_menu->addChild(m_color_sprite);
 	}
 
 	m_button_menu = CCMenu::create();
@@ -485,6 +516,42 @@ bool NamedIDCell<true>::init(NID idType, short id, std::string&& name, float wid
 	return true;
 }
 
+void NamedIDCell<true>::refreshColor()
+{
+	if (!m_color_sprite) return;
+
+	auto LEL = LevelEditorLayer::get();
+	if (!LEL) return;
+
+	auto effectManager = LEL->m_levelSettings->m_effectManager;
+
+	if (!effectManager->colorExists(m_id))
+		m_color_sprite->updateValues(nullptr);
+
+	auto colAction = effectManager->getColorAction(m_id);
+	m_color_sprite->updateValues(colAction);
+
+	// this is safe since updateCopyLabel just modifies visual data
+	if (!m_color_sprite->m_copyLabel)
+		m_color_sprite->updateCopyLabel(1, false);
+
+	if (colAction->m_copyID == 0)
+	{
+		switch (colAction->m_playerColor)
+		{
+			case 1:
+			case 2:
+				m_color_sprite->m_copyLabel->setString(fmt::format("P{}", colAction->m_playerColor).c_str());
+				m_color_sprite->m_copyLabel->setVisible(true);
+				break;
+
+			default:
+				m_color_sprite->m_copyLabel->setVisible(false);
+				break;
+		}
+	}
+}
+
 void NamedIDCell<true>::setDefaultBGColor(const ccColor4B& color)
 {
 	m_bg_color = color;
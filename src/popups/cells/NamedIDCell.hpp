@@ -3,6 +3,8 @@
 #include <string>
 #include <string_view>
 #include <array>
+#include <cstdint>
+#include <functional>
 
 #include <Geode/cocos/base_nodes/CCNode.h>
 #include <Geode/cocos/touch_dispatcher/CCTouchDelegateProtocol.h>
@@ -33,12 +35,26 @@ public:
 	void onDescriptionButton(cocos2d::CCObject*);
 
 	void showAdvancedOptions(bool);
+	// labels the cell with its ID type, for lists mixing them
+	void showIDType(bool);
+
+	// shows another Named ID in this cell, so lists can reuse it instead of creating a new one
+	void bind(NID, short, std::string_view);
+
+	// called after the Named ID was renamed or removed from this cell,
+	// without one the cell removes itself from its parent once its name is cleared
+	void setChangeCallback(std::function<void(NID, short)>&& cb) { m_on_change_cb = std::move(cb); }
 
 	virtual void colorSelectClosed(cocos2d::CCNode*) override;
 
+	NID getIDType() const { return m_id_type; }
 	short getID() const { return m_id; }
 	const std::string& getName() const& { return m_name; }
 
+private:
+	void cancelEditing();
+	void refreshPreviewState();
+
 private:
 	inline static NamedIDCell<false>* g_currentEditingItem = nullptr;
 
@@ -46,12 +62,18 @@ private:
 	short m_id;
 	std::string m_name;
 
+	bool m_adv_mode = false;
 	bool m_preview_toggled = true;
+	// extras generation the preview and description buttons were last updated for
+	std::uint32_t m_extras_generation = 0;
+
+	std::function<void(NID, short)> m_on_change_cb;
 
 	cocos2d::CCLayerColor* m_bg;
 	cocos2d::CCMenu* m_name_menu;
 	cocos2d::CCMenu* m_button_menu;
 	ButtonSprite* m_name_label;
+	cocos2d::CCLabelBMFont* m_type_label;
 	CCMenuItemSpriteExtra* m_color_button = nullptr;
 	ColorChannelSprite* m_color_sprite = nullptr;
 	CCMenuItemSpriteExtra* m_preview_button;
@@ -78,6 +100,8 @@ public:
 	void setDefaultBGColor(const cocos2d::ccColor4B& color);
 	void highlightQuery(const std::string_view);
 	void highlightQuery(const std::string_view, const std::array<std::uint8_t, 256>&);
+	// re-reads the color channel the swatch shows, for cells kept around while it gets edited
+	void refreshColor();
 
 	virtual void onEnter() override;
 	virtual void onEnterTransitionDidFinish() override;
@@ -0,0 +1,140 @@
+#include "AutoNameIndex.hpp"
+
+#include <algorithm>
+
+#include <NIDManager.hpp>
+
+#include "globals.hpp"
+
+using namespace ng::types;
+
+// the counters and dynamic counters/timers share a container, so they share their names too
+static NID canonicalNID(NID nid)
+{
+	return nid == NID::DYNAMIC_COUNTER_TIMER ? NID::COUNTER : nid;
+}
+
+AutoNameIndex& AutoNameIndex::get()
+{
+	static AutoNameIndex instance;
+
+	return instance;
+}
+
+int AutoNameIndex::getFreeSuffix(NID nid, std::string_view baseName, int preferred)
+{
+	auto& table = getTable(nid);
+
+	auto it = table.bases.find(baseName);
+	if (it == table.bases.end() || !it->second.used.contains(preferred))
+		return preferred;
+
+	return it->second.max + 1;
+}
+
+bool AutoNameIndex::isTaken(NID nid, std::string_view name)
+{
+	return NIDManager::getIDForName(nid, name).isOk() || getTable(nid).reserved.contains(name);
+}
+
+void AutoNameIndex::reserve(NID nid, std::string_view name)
+{
+	auto& table = getTable(nid);
+
+	table.reserved.emplace(name);
+	addName(table, name);
+}
+
+geode::Result<> AutoNameIndex::saveNamedIDs(NID nid, std::span<const std::pair<std::string, short>> namedIDs)
+{
+	auto& table = getTable(nid);
+
+	// the names the saved IDs lose, the sorted view is still valid before saving
+	const auto sortedNamedIDs = NIDManager::getSortedNamedIDs(nid);
+	for (const auto& [name, id] : namedIDs)
+	{
+		auto it = std::ranges::lower_bound(sortedNamedIDs, id, {}, &NIDManager::SortedNamedID::id);
+
+		if (it != sortedNamedIDs.end() && it->id == id)
+			removeName(table, it->name);
+	}
+
+	auto saveRes = NIDManager::saveNamedIDs(nid, namedIDs);
+
+	// removing the old names may have dropped suffixes that were also reserved
+	for (const auto& [name, _] : namedIDs)
+		addName(table, name);
+	table.reserved.clear();
+
+	// already up to date with this save
+	table.generation = NIDManager::getGeneration(nid);
+
+	return saveRes;
+}
+
+void AutoNameIndex::invalidate()
+{
+	for (auto& table : m_tables)
+	{
+		table.bases.clear();
+		table.reserved.clear();
+		table.built = false;
+	}
+}
+
+AutoNameIndex::Table& AutoNameIndex::getTable(NID nid)
+{
+	nid = canonicalNID(nid);
+
+	auto& table = m_tables[static_cast<std::size_t>(nid)];
+	const auto generation = NIDManager::getGeneration(nid);
+
+	if (table.built && table.generation == generation)
+		return table;
+
+	table.bases.clear();
+	table.reserved.clear();
+
+	if (auto namedIDs = NIDManager::getNamedIDs(nid))
+		for (const auto& [name, _] : namedIDs.unwrap())
+			addName(table, name);
+
+	table.generation = generation;
+	table.built = true;
+
+	return table;
+}
+
+void AutoNameIndex::addName(Table& table, std::string_view name)
+{
+	auto parts = ng::globals::g_buildHelperNameFormat.extract(name);
+	if (!parts) return;
+
+	auto numRes = geode::utils::numFromString<int>(parts->id);
+	if (numRes.isErr()) return;
+
+	const auto number = numRes.unwrap();
+
+	auto it = table.bases.find(parts->name);
+	if (it == table.bases.end())
+		it = table.bases.emplace(std::string{ parts->name }, Suffixes{}).first;
+
+	it->second.used.insert(number);
+	it->second.max = std::max(it->second.max, number);
+}
+
+void AutoNameIndex::removeName(Table& table, std::string_view name)
+{
+	auto parts = ng::globals::g_buildHelperNameFormat.extract(name);
+	if (!parts) return;
+
+	auto numRes = geode::utils::numFromString<int>(parts->id);
+	if (numRes.isErr()) return;
+
+	auto it = table.bases.find(parts->name);
+	if (it == table.bases.end()) return;
+
+	it->second.used.erase(numRes.unwrap());
+	if (it->second.used.empty())
+		table.bases.erase(it);
+}
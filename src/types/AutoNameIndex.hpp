@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <NIDEnum.hpp>
+
+namespace ng::types
+{
+	/**
+	 * @brief Numeric suffixes in use under the auto-name format, per NID and base name, so auto-naming
+	 * can pick a free name without walking every Named ID. Rebuilt from NIDManager whenever its
+	 * generation moves without going through saveNamedIDs.
+	 */
+	class AutoNameIndex
+	{
+	public:
+		static AutoNameIndex& get();
+
+		// preferred if no name uses it yet, otherwise the one after the highest suffix in use
+		int getFreeSuffix(NID, std::string_view baseName, int preferred);
+
+		// whether a Named ID or a name reserved for the pending batch already uses the name
+		bool isTaken(NID, std::string_view name);
+		// counts the name as used until the next saveNamedIDs, so names picked for one batch don't collide
+		void reserve(NID, std::string_view name);
+		// NIDManager::saveNamedIDs, also updating the index
+		geode::Result<> saveNamedIDs(NID, std::span<const std::pair<std::string, short>>);
+
+		// call after the auto-name format changed
+		void invalidate();
+
+	private:
+		struct Suffixes
+		{
+			std::unordered_set<int> used;
+			// may stay above the highest suffix after a removal, everything above it is still free
+			int max = 0;
+		};
+
+		struct Table
+		{
+			std::unordered_map<std::string, Suffixes, geode::utils::StringHash, std::equal_to<>> bases;
+			std::unordered_set<std::string, geode::utils::StringHash, std::equal_to<>> reserved;
+			std::uint32_t generation = 0;
+			bool built = false;
+		};
+
+		Table& getTable(NID);
+
+		static void addName(Table&, std::string_view);
+		static void removeName(Table&, std::string_view);
+
+	private:
+		std::array<Table, static_cast<std::size_t>(NID::_INTERNAL_LAST)> m_tables;
+	};
+}
@@ -8,8 +8,8 @@ AutofillInput::AutofillInput(
 	std::function<void(const std::string&)>&& editCb,
 	std::function<void(NID, short)>&& selectCb
 )
-	: nid(nid), autofillPreview(nullptr),
-		textInput(input), editInputCallback(std::move(editCb)),
+	: nid(nid), textInput(input),
+		editInputCallback(std::move(editCb)),
 		selectCallback(std::move(selectCb))
 {
 	input->setCallback([&](const std::string& str) {
@@ -21,17 +21,10 @@ AutofillInput::AutofillInput(const AutofillInput& other)
 {
 	this->nid = other.nid;
 	this->textInput = other.textInput;
-	this->autofillPreview.swap(other.autofillPreview);
 	this->editInputCallback = other.editInputCallback;
 	this->selectCallback = other.selectCallback;
 
 	this->textInput->setCallback([&](const std::string& str) {
-		if (!autofillPreview)
-		{
-			autofillPreview = AutofillNamedIDsPreview::create(nid, "");
-			autofillPreview->attachToInput(textInput);
-			autofillPreview->setSelectCallback(std::move(selectCallback));
-		}
 		this->onEditInput(str);
 	});
 }
@@ -40,7 +33,24 @@ void AutofillInput::onEditInput(const std::string& str)
 {
 	editInputCallback(str);
 
-	autofillPreview->updateList(nid, str);
+	auto autofillPreview = AutofillNamedIDsPreview::get();
+
+	autofillPreview->setSelectCallback([selectCallback = selectCallback](NID nid, short id) {
+		selectCallback(nid, id);
+	});
+
+	// the dropdown was showing another input's results, don't keep them up until the debounce fires
+	if (!autofillPreview->isAttachedTo(textInput))
+	{
+		autofillPreview->attachToInput(textInput);
+		autofillPreview->updateList(nid, str);
+	}
+	else
+	{
+		autofillPreview->attachToInput(textInput);
+		autofillPreview->queueUpdate(nid, str);
+	}
+
 	autofillPreview->show();
 
 	textInput->getInputNode()->onClickTrackNode(true);
@@ -53,17 +63,10 @@ AutofillInput& AutofillInput::operator=(const AutofillInput& other) noexcept
 
 	this->nid = other.nid;
 	this->textInput = other.textInput;
-	this->autofillPreview.swap(other.autofillPreview);
 	this->editInputCallback = other.editInputCallback;
 	this->selectCallback = other.selectCallback;
 
 	this->textInput->setCallback([&](const std::string& str) {
-		if (!autofillPreview)
-		{
-			autofillPreview = AutofillNamedIDsPreview::create(nid, "");
-			autofillPreview->attachToInput(textInput);
-			autofillPreview->setSelectCallback(std::move(selectCallback));
-		}
 		this->onEditInput(str);
 	});
 
@@ -77,17 +80,10 @@ AutofillInput& AutofillInput::operator=(AutofillInput&& other) noexcept
 
 	this->nid = other.nid;
 	this->textInput = other.textInput;
-	this->autofillPreview.swap(other.autofillPreview);
 	this->editInputCallback = std::move(other.editInputCallback);
 	this->selectCallback = std::move(other.selectCallback);
 
 	this->textInput->setCallback([&](const std::string& str) {
-		if (!autofillPreview)
-		{
-			autofillPreview = AutofillNamedIDsPreview::create(nid, "");
-			autofillPreview->attachToInput(textInput);
-			autofillPreview->setSelectCallback(std::move(selectCallback));
-		}
 		this->onEditInput(str);
 	});
 
@@ -20,7 +20,8 @@ struct AutofillInput
 	void onEditInput(const std::string&);
 
 	geode::TextInput* getInputNode() { return textInput; }
-	AutofillNamedIDsPreview* getAutofillPreview() { return autofillPreview; }
+	// shared by every input
+	AutofillNamedIDsPreview* getAutofillPreview() { return AutofillNamedIDsPreview::get(); }
 
 	void setEditInputCallback(std::function<void(const std::string&)>&& cb) { editInputCallback = std::move(cb); }
 	void setSelectCallback(std::function<void(NID, short)>&& cb) { selectCallback = std::move(cb); }
@@ -28,11 +29,10 @@ struct AutofillInput
 	AutofillInput& operator=(const AutofillInput&) noexcept;
 	AutofillInput& operator=(AutofillInput&&) noexcept;
 	geode::TextInput* operator->() { return textInput; }
-	operator bool() { return autofillPreview; }
+	operator bool() { return textInput; }
 
 	NID nid;
-	geode::TextInput* textInput;
-	geode::Ref<AutofillNamedIDsPreview> autofillPreview;
+	geode::TextInput* textInput = nullptr;
 	std::function<void(const std::string&)> editInputCallback;
 	std::function<void(NID, short)> selectCallback;
 };
@@ -0,0 +1,150 @@
+#include "DescriptionIndex.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+#include "constants.hpp"
+
+using namespace ng::types;
+
+// the counters and dynamic counters/timers share a container, so they share their descriptions too
+static NID canonicalNID(NID nid)
+{
+	return nid == NID::DYNAMIC_COUNTER_TIMER ? NID::COUNTER : nid;
+}
+
+DescriptionIndex& DescriptionIndex::get()
+{
+	static DescriptionIndex instance;
+
+	return instance;
+}
+
+void DescriptionIndex::set(NID nid, short id, std::string_view description)
+{
+	remove(nid, id);
+
+	auto words = tokenize(description);
+	if (words.empty()) return;
+
+	const auto key = makeKey(nid, id);
+
+	for (const auto& word : words)
+		m_postings[word].insert(key);
+
+	m_document_words[key] = std::move(words);
+}
+
+void DescriptionIndex::remove(NID nid, short id)
+{
+	auto it = m_document_words.find(makeKey(nid, id));
+	if (it == m_document_words.end()) return;
+
+	for (const auto& word : it->second)
+	{
+		auto postingsIt = m_postings.find(word);
+		if (postingsIt == m_postings.end()) continue;
+
+		postingsIt->second.erase(it->first);
+		if (postingsIt->second.empty())
+			m_postings.erase(postingsIt);
+	}
+
+	m_document_words.erase(it);
+}
+
+void DescriptionIndex::clear()
+{
+	m_postings.clear();
+	m_document_words.clear();
+}
+
+std::vector<DescriptionIndex::Result> DescriptionIndex::search(NID nid, std::string_view query) const
+{
+	std::vector<Result> results;
+
+	const auto words = tokenize(query);
+	if (words.empty()) return results;
+
+	const bool allNIDs = nid == ng::constants::ALL_NIDS;
+	nid = canonicalNID(nid);
+
+	std::unordered_map<Key, Result> found;
+	// a description can contain several words starting with the same query word, count it once
+	std::unordered_map<Key, bool> wordMatches;
+
+	for (const auto& word : words)
+	{
+		wordMatches.clear();
+
+		for (
+			auto it = m_postings.lower_bound(word);
+			it != m_postings.end() && it->first.starts_with(word);
+			++it
+		) {
+			const bool exact = it->first.size() == word.size();
+
+			for (const auto key : it->second)
+			{
+				if (!allNIDs && keyNID(key) != nid) continue;
+
+				wordMatches[key] |= exact;
+			}
+		}
+
+		for (const auto [key, exact] : wordMatches)
+		{
+			auto [it, inserted] = found.try_emplace(key, Result{ keyNID(key), keyID(key), 0, 0 });
+
+			it->second.matchedWords++;
+			if (exact)
+				it->second.exactWords++;
+		}
+	}
+
+	results.reserve(found.size());
+	for (const auto& [key, result] : found)
+		results.push_back(result);
+
+	std::sort(results.begin(), results.end(), [](const Result& a, const Result& b) {
+		if (a.matchedWords != b.matchedWords) return a.matchedWords > b.matchedWords;
+		if (a.exactWords != b.exactWords) return a.exactWords > b.exactWords;
+		if (a.nid != b.nid) return a.nid < b.nid;
+
+		return a.id < b.id;
+	});
+
+	return results;
+}
+
+std::vector<std::string> DescriptionIndex::tokenize(std::string_view text)
+{
+	std::vector<std::string> words;
+	std::string word;
+
+	auto pushWord = [&] {
+		if (word.empty()) return;
+
+		if (std::find(words.begin(), words.end(), word) == words.end())
+			words.push_back(std::move(word));
+
+		word.clear();
+	};
+
+	for (const char c : text)
+	{
+		if (std::isalnum(static_cast<unsigned char>(c)))
+			word += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+		else
+			pushWord();
+	}
+	pushWord();
+
+	return words;
+}
+
+DescriptionIndex::Key DescriptionIndex::makeKey(NID nid, short id)
+{
+	return static_cast<Key>(static_cast<std::uint8_t>(canonicalNID(nid))) << 16
+		| static_cast<std::uint16_t>(id);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <NIDEnum.hpp>
+
+namespace ng::types
+{
+	/**
+	 * @brief Inverted index from the (lowercase, alphanumeric) words of Named ID descriptions
+	 * to the Named IDs using them. NIDExtrasManager keeps it up to date as descriptions change.
+	 */
+	class DescriptionIndex
+	{
+	public:
+		struct Result
+		{
+			NID nid;
+			short id;
+			// query words found in the description
+			std::uint32_t matchedWords;
+			// of which the description contains as a whole word, not only as a prefix
+			std::uint32_t exactWords;
+		};
+
+		static DescriptionIndex& get();
+
+		void set(NID, short, std::string_view);
+		void remove(NID, short);
+		void clear();
+
+		// descriptions containing any word of the query, also as the start of a longer word,
+		// the ones matching the most words first. ng::constants::ALL_NIDS searches all of them
+		std::vector<Result> search(NID, std::string_view) const;
+
+		static std::vector<std::string> tokenize(std::string_view);
+
+	private:
+		using Key = std::uint32_t;
+
+		static Key makeKey(NID, short);
+		static NID keyNID(Key key) { return static_cast<NID>(key >> 16); }
+		static short keyID(Key key) { return static_cast<short>(key & 0xFFFF); }
+
+	private:
+		// sorted so prefixes of a word can be looked up as a range
+		std::map<std::string, std::unordered_set<Key>, std::less<>> m_postings;
+		std::unordered_map<Key, std::vector<std::string>> m_document_words;
+	};
+}
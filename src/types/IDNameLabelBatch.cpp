@@ -0,0 +1,323 @@
+#include "IDNameLabelBatch.hpp"
+
+#include <algorithm>
+
+#include "LabelRefreshScheduler.hpp"
+#include "globals.hpp"
+
+using namespace geode::prelude;
+using namespace ng::types;
+
+IDNameLabelBatch* IDNameLabelBatch::create(const char* fntFile, CCNode* objectLayer)
+{
+	auto ret = new IDNameLabelBatch();
+
+	if (ret && ret->init(fntFile, objectLayer))
+		ret->autorelease();
+	else
+	{
+		delete ret;
+		ret = nullptr;
+	}
+
+	return ret;
+}
+
+bool IDNameLabelBatch::init(const char* fntFile, CCNode* objectLayer)
+{
+	m_layout_label = CCLabelBMFont::create("", fntFile);
+	if (!m_layout_label) return false;
+
+	if (!CCSpriteBatchNode::initWithTexture(m_layout_label->getTexture(), 29)) return false;
+
+	m_object_layer = objectLayer;
+
+	return true;
+}
+
+void IDNameLabelBatch::setLabel(GameObject* object, std::string_view str, const CCPoint& position, bool visible)
+{
+	if (str.empty())
+		return removeLabel(object);
+
+	auto it = m_labels.find(object);
+
+	// the object this label belonged to died, and a new one got allocated at the same address
+	if (it != m_labels.end() && !it->second.owner.lock())
+	{
+		removeLabel(object);
+		it = m_labels.end();
+	}
+
+	if (it == m_labels.end())
+	{
+		if (m_labels.size() >= m_prune_at)
+			pruneDeadLabels();
+
+		auto root = CCSprite::createWithTexture(this->getTexture(), CCRectZero);
+		root->setCascadeOpacityEnabled(true);
+		this->addChild(root);
+
+		Label label;
+		label.owner = WeakRef<GameObject>(object);
+		label.root = root;
+
+		it = m_labels.emplace(object, std::move(label)).first;
+	}
+
+	auto& label = it->second;
+	label.visible = visible;
+	markDirty(object);
+
+	// the glyphs are already in place
+	if (!label.string.empty() && label.string == str && label.position == position)
+		return;
+
+	label.string = str;
+	label.position = position;
+	label.dirty = true;
+
+	layoutLabel(label, position);
+}
+
+void IDNameLabelBatch::removeLabel(GameObject* object)
+{
+	auto it = m_labels.find(object);
+	if (it == m_labels.end()) return;
+
+	it->second.root->removeFromParent();
+	m_labels.erase(it);
+}
+
+void IDNameLabelBatch::markDirty(GameObject* object)
+{
+	auto it = m_labels.find(object);
+	if (it == m_labels.end() || it->second.queued) return;
+
+	it->second.queued = true;
+	m_dirty_labels.push_back(object);
+}
+
+void IDNameLabelBatch::markAllDirty()
+{
+	for (auto& [object, label] : m_labels)
+	{
+		if (label.queued) continue;
+
+		label.queued = true;
+		m_dirty_labels.push_back(object);
+	}
+}
+
+bool IDNameLabelBatch::isZoomedOut() const
+{
+	return m_object_layer && m_object_layer->getScale() < ng::globals::g_labelLODZoom;
+}
+
+void IDNameLabelBatch::deferLabel(GameObject* object)
+{
+	auto& deferred = m_deferred[object];
+
+	// stale entry of a dead object at the same address
+	if (!deferred.lock())
+		deferred = WeakRef<GameObject>(object);
+}
+
+void IDNameLabelBatch::refreshDeferredLabels()
+{
+	auto scheduler = LabelRefreshScheduler::get();
+
+	for (auto& [_, object] : m_deferred)
+		if (auto owner = object.lock())
+			scheduler->queue(owner);
+
+	m_deferred.clear();
+}
+
+void IDNameLabelBatch::pruneDeadLabels()
+{
+	for (auto it = m_labels.begin(); it != m_labels.end();)
+	{
+		if (it->second.owner.lock())
+		{
+			++it;
+			continue;
+		}
+
+		it->second.root->removeFromParent();
+		it = m_labels.erase(it);
+	}
+
+	m_prune_at = std::max<std::size_t>(m_labels.size() * 2, 64);
+}
+
+void IDNameLabelBatch::visit()
+{
+	if (!this->isVisible()) return;
+
+	// labels would only be a few pixels tall, don't bother syncing nor drawing them
+	if (isZoomedOut()) return;
+
+	if (!m_deferred.empty())
+		refreshDeferredLabels();
+
+	// syncing never marks another label dirty
+	for (auto object : m_dirty_labels)
+	{
+		auto it = m_labels.find(object);
+		if (it == m_labels.end()) continue;
+
+		it->second.queued = false;
+
+		if (auto owner = it->second.owner.lock())
+			syncLabel(it->second, owner);
+		else
+		{
+			it->second.root->removeFromParent();
+			m_labels.erase(it);
+		}
+	}
+	m_dirty_labels.clear();
+
+	CCSpriteBatchNode::visit();
+}
+
+const IDNameLabelBatch::StringLayout& IDNameLabelBatch::getStringLayout(std::string_view str)
+{
+	// names get renamed a lot less than this, it's only here so the cache can't grow forever
+	static constexpr std::size_t MAX_CACHED_LAYOUTS = 4096;
+
+	if (auto it = m_string_layouts.find(str); it != m_string_layouts.end())
+		return it->second;
+
+	if (m_string_layouts.size() >= MAX_CACHED_LAYOUTS)
+		m_string_layouts.clear();
+
+	m_layout_label->setString(std::string{ str }.c_str());
+	m_layout_label->limitLabelWidth(MAX_LABEL_WIDTH, .5f, .1f);
+
+	StringLayout layout;
+	layout.scale = m_layout_label->getScale();
+
+	const CCSize& size = m_layout_label->getContentSize();
+	const CCPoint& anchor = m_layout_label->getAnchorPoint();
+	const CCPoint origin{
+		-size.width * anchor.x * layout.scale,
+		-size.height * anchor.y * layout.scale
+	};
+
+	if (auto layoutGlyphs = m_layout_label->getChildren())
+	{
+		layout.glyphs.reserve(layoutGlyphs->count());
+
+		for (auto layoutGlyph : CCArrayExt<CCSprite*>(layoutGlyphs))
+		{
+			// CCLabelBMFont hides the glyphs it didn't need instead of removing them
+			if (!layoutGlyph->isVisible()) continue;
+
+			layout.glyphs.push_back({
+				.rect = layoutGlyph->getTextureRect(),
+				.rotated = layoutGlyph->isTextureRectRotated(),
+				.size = layoutGlyph->getContentSize(),
+				.anchor = layoutGlyph->getAnchorPoint(),
+				.offset = origin + layoutGlyph->getPosition() * layout.scale,
+				.scale = layoutGlyph->getScale() * layout.scale
+			});
+		}
+	}
+
+	return m_string_layouts.emplace(std::string{ str }, std::move(layout)).first->second;
+}
+
+void IDNameLabelBatch::layoutLabel(Label& label, const CCPoint& position)
+{
+	const StringLayout& layout = getStringLayout(label.string);
+
+	CCArray* glyphs = label.root->getChildren();
+	unsigned int glyphCount = glyphs ? glyphs->count() : 0;
+	unsigned int used = 0;
+
+	for (const auto& glyphLayout : layout.glyphs)
+	{
+		CCSprite* glyph;
+
+		if (used < glyphCount)
+			glyph = static_cast<CCSprite*>(glyphs->objectAtIndex(used));
+		else
+		{
+			glyph = CCSprite::createWithTexture(this->getTexture(), glyphLayout.rect);
+			label.root->addChild(glyph);
+		}
+
+		glyph->setTextureRect(glyphLayout.rect, glyphLayout.rotated, glyphLayout.size);
+		glyph->setAnchorPoint(glyphLayout.anchor);
+		glyph->setPosition(position + glyphLayout.offset);
+		glyph->setScale(glyphLayout.scale);
+		glyph->setVisible(true);
+
+		used++;
+	}
+
+	// keep the leftovers around for the next string
+	for (unsigned int idx = used; idx < glyphCount; idx++)
+		static_cast<CCSprite*>(glyphs->objectAtIndex(idx))->setVisible(false);
+}
+
+void IDNameLabelBatch::syncLabel(Label& label, GameObject* owner)
+{
+	CCNode* parent = owner->getParent();
+
+	if (label.dirty || parent != label.ownerParent)
+	{
+		label.ownerParent = parent;
+		label.isInLevel = parent && isInLevel(parent);
+	}
+
+	const bool visible = label.visible && label.isInLevel && owner->isVisible();
+	label.root->setVisible(visible);
+
+	if (!visible) return;
+
+	if (label.root->getOpacity() != owner->getDisplayedOpacity())
+		label.root->setOpacity(owner->getDisplayedOpacity());
+
+	const CCPoint& position = owner->getPosition();
+	const float rotationX = owner->getRotationX();
+	const float rotationY = owner->getRotationY();
+	const float scaleX = owner->getScaleX();
+	const float scaleY = owner->getScaleY();
+
+	if (
+		!label.dirty &&
+		position == label.ownerPosition &&
+		rotationX == label.ownerRotationX && rotationY == label.ownerRotationY &&
+		scaleX == label.ownerScaleX && scaleY == label.ownerScaleY
+	)
+		return;
+
+	label.dirty = false;
+	label.ownerPosition = position;
+	label.ownerRotationX = rotationX;
+	label.ownerRotationY = rotationY;
+	label.ownerScaleX = scaleX;
+	label.ownerScaleY = scaleY;
+
+	// the root mirrors the object, so glyphs can be positioned like children of the object
+	label.root->setContentSize(owner->getContentSize());
+	label.root->setAnchorPoint(owner->getAnchorPoint());
+	label.root->setPosition(this->convertToNodeSpace(parent->convertToWorldSpace(position)));
+	label.root->setRotationX(rotationX);
+	label.root->setRotationY(rotationY);
+	label.root->setScaleX(scaleX);
+	label.root->setScaleY(scaleY);
+}
+
+bool IDNameLabelBatch::isInLevel(CCNode* node) const
+{
+	// objects shown in the editor's object buttons aren't part of the level
+	for (; node; node = node->getParent())
+		if (node == m_object_layer)
+			return true;
+
+	return false;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Geode/cocos/sprite_nodes/CCSpriteBatchNode.h>
+#include <Geode/cocos/label_nodes/CCLabelBMFont.h>
+#include <Geode/binding/GameObject.hpp>
+#include <Geode/utils/cocos.hpp>
+
+namespace ng::types
+{
+	/**
+	 * @brief Draws the ID name labels of every object in a single draw call.
+	 * Glyphs are laid out by a (never drawn) CCLabelBMFont and copied into sprites of this batch node,
+	 * each label follows the transform of the object that owns it.
+	 * Labels are only synced with their object after markDirty(), so idle labels cost nothing per frame.
+	 */
+	class IDNameLabelBatch : public cocos2d::CCSpriteBatchNode
+	{
+	public:
+		// 28.5f is content width of move trigger, which works well for all other triggers
+		static constexpr float MAX_LABEL_WIDTH = 28.5f + 10.f;
+
+		static IDNameLabelBatch* create(const char*, cocos2d::CCNode*);
+
+	protected:
+		bool init(const char*, cocos2d::CCNode*);
+
+	public:
+		// position is in the object's node space, like if the label was a child of it
+		void setLabel(GameObject*, std::string_view, const cocos2d::CCPoint&, bool);
+		void removeLabel(GameObject*);
+		// the object's transform, visibility, opacity or parent may have changed, its label is synced on the next visit
+		void markDirty(GameObject*);
+		void markAllDirty();
+
+		// true when the editor is zoomed out too far for labels to be readable
+		bool isZoomedOut() const;
+		// remembers the object so its label is refreshed once zoomed back in
+		void deferLabel(GameObject*);
+
+		virtual void visit() override;
+
+	private:
+		struct GlyphLayout
+		{
+			cocos2d::CCRect rect;
+			bool rotated;
+			cocos2d::CCSize size;
+			cocos2d::CCPoint anchor;
+			// relative to the label's position
+			cocos2d::CCPoint offset;
+			float scale;
+		};
+
+		// result of laying out (and width limiting) a string, shared by every label showing it
+		struct StringLayout
+		{
+			std::vector<GlyphLayout> glyphs;
+			float scale;
+		};
+
+		struct Label
+		{
+			geode::WeakRef<GameObject> owner;
+			geode::Ref<cocos2d::CCSprite> root;
+			std::string string;
+			cocos2d::CCPoint position{ .0f, .0f };
+			bool visible = true;
+			bool dirty = true;
+			// already in m_dirty_labels
+			bool queued = false;
+
+			// owner state the root was last synced with
+			cocos2d::CCNode* ownerParent = nullptr;
+			bool isInLevel = false;
+			cocos2d::CCPoint ownerPosition{ .0f, .0f };
+			float ownerRotationX = .0f;
+			float ownerRotationY = .0f;
+			float ownerScaleX = .0f;
+			float ownerScaleY = .0f;
+		};
+
+		const StringLayout& getStringLayout(std::string_view);
+		void layoutLabel(Label&, const cocos2d::CCPoint&);
+		void refreshDeferredLabels();
+		void pruneDeadLabels();
+		void syncLabel(Label&, GameObject*);
+		bool isInLevel(cocos2d::CCNode*) const;
+
+	private:
+		// the node objects live in, labels of objects outside of it are never shown
+		cocos2d::CCNode* m_object_layer = nullptr;
+
+		geode::Ref<cocos2d::CCLabelBMFont> m_layout_label;
+		std::unordered_map<GameObject*, Label> m_labels;
+		// objects whose label has to be synced on the next visit
+		std::vector<GameObject*> m_dirty_labels;
+		// dead objects are only noticed when synced, prune them once this many labels exist
+		std::size_t m_prune_at = 64;
+		std::unordered_map<std::string, StringLayout, geode::utils::StringHash, std::equal_to<>> m_string_layouts;
+		// objects whose label update was skipped while zoomed out
+		std::unordered_map<GameObject*, geode::WeakRef<GameObject>> m_deferred;
+	};
+}
@@ -0,0 +1,162 @@
+#include "LabelRefreshScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <Geode/cocos/CCDirector.h>
+
+#include "benchmark.hpp"
+#include "globals.hpp"
+
+using namespace geode::prelude;
+using namespace ng::types;
+
+LabelRefreshScheduler* LabelRefreshScheduler::get()
+{
+	static LabelRefreshScheduler* instance = [] {
+		auto scheduler = new LabelRefreshScheduler();
+		// never released, lives as long as the mod
+		scheduler->retain();
+		return scheduler;
+	}();
+
+	return instance;
+}
+
+void LabelRefreshScheduler::queue(GameObject* object)
+{
+	// 1816 is player object, which has a hidden object label
+	if (!object || object->m_objectID == 1816u) return;
+
+	if (!m_queued.insert(object).second) return;
+
+	m_queue.emplace_back(object);
+	m_needs_prioritize = true;
+
+	setScheduled(true);
+}
+
+void LabelRefreshScheduler::queueAll()
+{
+	const auto lel = LevelEditorLayer::get();
+	if (!lel) return;
+
+	m_queue.reserve(m_queue.size() + lel->m_activeObjects.size());
+
+	// trigger can be nullptr for some fucking reason
+	for (auto trigger : lel->m_activeObjects)
+		queue(trigger);
+}
+
+void LabelRefreshScheduler::flush()
+{
+	if (const auto lel = LevelEditorLayer::get())
+	{
+		// updating a label never queues another one, but iterate on a moved out copy anyway
+		auto objects = std::move(m_queue);
+		m_queue.clear();
+		m_queued.clear();
+
+		for (auto& object : objects)
+			lel->updateObjectLabel(object);
+	}
+
+	clear();
+}
+
+void LabelRefreshScheduler::clear()
+{
+	m_queue.clear();
+	m_queued.clear();
+	m_needs_prioritize = false;
+
+	setScheduled(false);
+}
+
+void LabelRefreshScheduler::update(float)
+{
+	const auto lel = LevelEditorLayer::get();
+	if (!lel) return clear();
+
+	prioritizeVisible(lel);
+
+	const std::uint64_t budget = budgetCycles();
+	const auto start = ng::debug::proc_timestamp_clock::now();
+
+	// always update at least one label so the queue can't stall
+	while (!m_queue.empty())
+	{
+		geode::Ref<GameObject> object = std::move(m_queue.back());
+		m_queue.pop_back();
+		m_queued.erase(object);
+
+		lel->updateObjectLabel(object);
+
+		if (static_cast<std::uint64_t>((ng::debug::proc_timestamp_clock::now() - start).count()) >= budget)
+			break;
+	}
+
+	if (m_queue.empty())
+		clear();
+}
+
+void LabelRefreshScheduler::prioritizeVisible(LevelEditorLayer* lel)
+{
+	const auto objectLayer = lel->m_objectLayer;
+	const auto viewOrigin = objectLayer->getPosition();
+	const float viewScale = objectLayer->getScale();
+
+	// only re-sort if the camera moved or new objects were queued
+	if (!m_needs_prioritize && viewOrigin == m_last_view_origin && viewScale == m_last_view_scale)
+		return;
+
+	m_last_view_origin = viewOrigin;
+	m_last_view_scale = viewScale;
+	m_needs_prioritize = false;
+
+	const CCRect viewRect = visibleRect(lel);
+
+	std::stable_partition(m_queue.begin(), m_queue.end(), [&viewRect](const geode::Ref<GameObject>& object) {
+		return !viewRect.containsPoint(object->getPosition());
+	});
+}
+
+void LabelRefreshScheduler::setScheduled(bool state)
+{
+	if (m_scheduled == state) return;
+
+	m_scheduled = state;
+
+	if (state)
+		CCScheduler::get()->scheduleUpdateForTarget(this, 0, false);
+	else
+		CCScheduler::get()->unscheduleUpdateForTarget(this);
+}
+
+std::uint64_t LabelRefreshScheduler::budgetCycles()
+{
+	const double budgetNs = ng::globals::g_labelRefreshBudget * 1'000'000.0;
+
+	return static_cast<std::uint64_t>(
+		budgetNs * ng::debug::proc_timestamp_clock::m_calibrationData.cycles_per_ns
+	);
+}
+
+CCRect LabelRefreshScheduler::visibleRect(LevelEditorLayer* lel)
+{
+	// labels hang slightly below their object, pad the view so they aren't left out
+	static constexpr float PADDING = 30.f;
+
+	const auto objectLayer = lel->m_objectLayer;
+	const CCSize& winSize = CCDirector::sharedDirector()->getWinSize();
+
+	const CCPoint bottomLeft = objectLayer->convertToNodeSpace({ .0f, .0f });
+	const CCPoint topRight = objectLayer->convertToNodeSpace({ winSize.width, winSize.height });
+
+	return CCRect{
+		std::min(bottomLeft.x, topRight.x) - PADDING,
+		std::min(bottomLeft.y, topRight.y) - PADDING,
+		std::abs(topRight.x - bottomLeft.x) + PADDING * 2.f,
+		std::abs(topRight.y - bottomLeft.y) + PADDING * 2.f
+	};
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <unordered_set>
+
+#include <Geode/cocos/cocoa/CCObject.h>
+#include <Geode/cocos/cocoa/CCGeometry.h>
+#include <Geode/binding/GameObject.hpp>
+#include <Geode/binding/LevelEditorLayer.hpp>
+#include <Geode/utils/cocos.hpp>
+
+namespace ng::types
+{
+	/**
+	 * @brief Spreads object label updates over multiple frames.
+	 * Each frame at most `ng::globals::g_labelRefreshBudget` milliseconds are spent
+	 * updating labels, objects that are on screen are updated first.
+	 */
+	class LabelRefreshScheduler : public cocos2d::CCObject
+	{
+	public:
+		static LabelRefreshScheduler* get();
+
+		void queue(GameObject*);
+		void queueAll();
+		// updates every queued label right away, ignoring the budget
+		void flush();
+		void clear();
+
+		virtual void update(float) override;
+
+	private:
+		LabelRefreshScheduler() = default;
+
+		void prioritizeVisible(LevelEditorLayer*);
+		void setScheduled(bool);
+
+		static std::uint64_t budgetCycles();
+		static cocos2d::CCRect visibleRect(LevelEditorLayer*);
+
+	private:
+		// processed back to front, on screen objects are moved to the back
+		std::vector<geode::Ref<GameObject>> m_queue;
+		std::unordered_set<GameObject*> m_queued;
+
+		cocos2d::CCPoint m_last_view_origin{ -1.f, -1.f };
+		float m_last_view_scale = .0f;
+		bool m_needs_prioritize = false;
+		bool m_scheduled = false;
+	};
+}
@@ -0,0 +1,461 @@
+#include "NIDSearchIndex.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iterator>
+
+#include <NIDManager.hpp>
+
+#include "WorkerPool.hpp"
+
+#include "fuzzy_match.hpp"
+#include "globals.hpp"
+#include "constants.hpp"
+#include "operators.hpp"
+
+using namespace ng::types;
+
+// the characters a name can be made of (see ng::utils::sanitizeName) all get their own bit,
+// anything else shares the last one
+static constexpr std::uint8_t OTHER_CHAR_BIT = 63;
+
+// below this, handing chunks to other threads costs more than scoring everything right away
+static constexpr std::size_t PARALLEL_SCORING_MIN_CANDIDATES = 2048;
+static constexpr std::size_t PARALLEL_SCORING_CHUNK_SIZE = 256;
+
+static constexpr auto CHAR_BITS = [] {
+	std::array<std::uint8_t, 256> bits{};
+	bits.fill(OTHER_CHAR_BIT);
+
+	std::uint8_t bit = 0;
+
+	for (char c = 'a'; c <= 'z'; c++)
+	{
+		bits[static_cast<std::uint8_t>(c)] = bit;
+		bits[static_cast<std::uint8_t>(c - 'a' + 'A')] = bit;
+		bit++;
+	}
+
+	for (char c = '0'; c <= '9'; c++)
+		bits[static_cast<std::uint8_t>(c)] = bit++;
+
+	for (char c : std::string_view{ "@_-,.!$^&*()+=/<>?\\" })
+		bits[static_cast<std::uint8_t>(c)] = bit++;
+
+	return bits;
+}();
+
+static std::string toLower(std::string_view str)
+{
+	std::string lower{ str };
+
+	for (auto& c : lower)
+		c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+	return lower;
+}
+
+// fts::fuzzy_match matches iff the (case folded) pattern is a subsequence of the string,
+// this answers that without scoring
+static bool isSubsequence(std::string_view pattern, std::string_view str)
+{
+	auto it = pattern.begin();
+
+	for (char c : str)
+		if (it != pattern.end() && *it == c)
+			++it;
+
+	return it == pattern.end();
+}
+
+static constexpr std::uint32_t packTrigram(std::string_view str, std::size_t pos)
+{
+	return
+		static_cast<std::uint32_t>(static_cast<std::uint8_t>(str[pos])) |
+		static_cast<std::uint32_t>(static_cast<std::uint8_t>(str[pos + 1])) << 8 |
+		static_cast<std::uint32_t>(static_cast<std::uint8_t>(str[pos + 2])) << 16;
+}
+
+// appends the trigrams of an already case folded string
+static void collectTrigrams(std::string_view str, std::vector<std::uint32_t>& out)
+{
+	for (std::size_t pos = 0; pos + 3 <= str.size(); pos++)
+		out.push_back(packTrigram(str, pos));
+}
+
+// calls `func(nid)` for every NID the index of `nid` spans
+template <typename F>
+static void forEachIndexedNID(NID nid, F&& func)
+{
+	if (nid != ng::constants::ALL_NIDS)
+		return func(nid);
+
+	// skip NID::DYNAMIC_COUNTER_TIMER, it shares the counters container
+	for (NID type = NID::GROUP; type < NID::_INTERNAL_LAST - 1; type = type + 1)
+		func(type);
+}
+
+static std::uint32_t generationOf(NID nid)
+{
+	// generations only ever go up, so the sum changes whenever one of them does
+	std::uint32_t generation = 0;
+	forEachIndexedNID(nid, [&](NID type) { generation += NIDManager::getGeneration(type); });
+
+	return generation;
+}
+
+static void sortUnique(std::vector<std::uint32_t>& vec)
+{
+	std::sort(vec.begin(), vec.end());
+	vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+}
+
+
+NIDSearchIndex::Query::Query(std::string_view str)
+	: query(str), lowerQuery(toLower(str)), charMask(charMaskOf(str)),
+		threshold(static_cast<double>(50 + 5 * str.size()))
+{
+	collectTrigrams(lowerQuery, trigrams);
+	sortUnique(trigrams);
+}
+
+std::size_t NIDSearchIndex::TrigramIndex::getMemoryUsage() const
+{
+	// rough, the node size of the map is implementation defined
+	std::size_t size = sizeof(*this) + postings.bucket_count() * sizeof(void*);
+
+	for (const auto& [_, entries] : postings)
+		size += sizeof(void*) + sizeof(std::uint32_t) + sizeof(entries) + entries.capacity() * sizeof(std::uint32_t);
+
+	return size;
+}
+
+NIDSearchIndex::NIDSearchIndex(NID nid, std::uint32_t generation)
+	: m_nid(nid), m_generation(generation)
+{
+	// NIDs are visited in order and each one's Named IDs come sorted by ID, so the entries end up sorted too
+	forEachIndexedNID(nid, [&](NID type) {
+		const auto namedIDs = NIDManager::getSortedNamedIDs(type);
+
+		m_entries.reserve(m_entries.size() + namedIDs.size());
+
+		for (const auto& [name, id] : namedIDs)
+		{
+			auto idString = fmt::format("{}", id);
+			const auto charMask = charMaskOf(name) | charMaskOf(idString);
+
+			m_entries.push_back({
+				.name = std::string{ name },
+				.lowerName = toLower(name),
+				.idString = std::move(idString),
+				.charMask = charMask,
+				.nid = type,
+				.id = id
+			});
+		}
+	});
+
+	m_char_masks.reserve(m_entries.size());
+	for (const auto& entry : m_entries)
+		m_char_masks.push_back(entry.charMask);
+}
+
+std::shared_ptr<const NIDSearchIndex> NIDSearchIndex::get(NID nid)
+{
+	static std::array<std::shared_ptr<const NIDSearchIndex>, static_cast<std::size_t>(NID::_INTERNAL_LAST)> indices;
+
+	// ALL_NIDS is 0, which no single NID uses
+	auto& index = indices.at(static_cast<std::size_t>(nid));
+	const auto generation = generationOf(nid);
+
+	if (!index || index->m_generation != generation)
+		index = std::shared_ptr<const NIDSearchIndex>(new NIDSearchIndex(nid, generation));
+
+	return index;
+}
+
+std::optional<std::uint32_t> NIDSearchIndex::find(NID nid, short id) const
+{
+	auto it = std::lower_bound(m_entries.begin(), m_entries.end(), std::pair{ nid, id }, [](const Entry& entry, const auto& key) {
+		return entry.nid != key.first ? entry.nid < key.first : entry.id < key.second;
+	});
+
+	if (it == m_entries.end() || it->nid != nid || it->id != id)
+		return std::nullopt;
+
+	return static_cast<std::uint32_t>(it - m_entries.begin());
+}
+
+std::uint64_t NIDSearchIndex::charMaskOf(std::string_view str)
+{
+	std::uint64_t mask = 0;
+
+	for (char c : str)
+		mask |= std::uint64_t{ 1 } << CHAR_BITS[static_cast<std::uint8_t>(c)];
+
+	return mask;
+}
+
+void NIDSearchIndex::filterByCharMask(std::uint64_t charMask, std::vector<std::uint32_t>& out) const
+{
+	const auto count = static_cast<std::uint32_t>(m_char_masks.size());
+	const std::uint64_t* masks = m_char_masks.data();
+
+	out.resize(count);
+	std::uint32_t* indices = out.data();
+	std::uint32_t found = 0;
+
+	// branchless, every index is written and only kept if its entry passed
+	for (std::uint32_t idx = 0; idx < count; idx++)
+	{
+		indices[found] = idx;
+		found += (charMask & ~masks[idx]) == 0;
+	}
+
+	out.resize(found);
+}
+
+bool NIDSearchIndex::canUseTrigrams(const Query& query) const
+{
+	return
+		ng::globals::g_useTrigramSearch &&
+		!query.trigrams.empty() &&
+		m_entries.size() >= static_cast<std::size_t>(ng::globals::g_trigramSearchMinSize);
+}
+
+const NIDSearchIndex::TrigramIndex& NIDSearchIndex::getTrigramIndex() const
+{
+	std::call_once(m_trigrams_built, [this] {
+		NID_DEBUG(const auto start = std::chrono::steady_clock::now();)
+
+		auto trigrams = std::make_unique<TrigramIndex>();
+		std::vector<std::uint32_t> entryTrigrams;
+
+		for (std::uint32_t idx = 0; idx < m_entries.size(); idx++)
+		{
+			entryTrigrams.clear();
+			collectTrigrams(m_entries[idx].lowerName, entryTrigrams);
+			collectTrigrams(m_entries[idx].idString, entryTrigrams);
+			sortUnique(entryTrigrams);
+
+			// entries are visited in order, so every posting list ends up sorted
+			for (auto trigram : entryTrigrams)
+				trigrams->postings[trigram].push_back(idx);
+		}
+
+		NID_DEBUG(
+			geode::log::debug(
+				"Built trigram index of {} entries: {} trigrams, ~{} KiB, {}us",
+				m_entries.size(), trigrams->postings.size(), trigrams->getMemoryUsage() / 1024,
+				std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+			);
+		)
+
+		m_trigrams = std::move(trigrams);
+	});
+
+	return *m_trigrams;
+}
+
+void NIDSearchIndex::filterByTrigrams(const Query& query, std::vector<std::uint32_t>& out) const
+{
+	const auto& postings = getTrigramIndex().postings;
+
+	std::vector<const std::vector<std::uint32_t>*> lists;
+	lists.reserve(query.trigrams.size());
+
+	for (auto trigram : query.trigrams)
+	{
+		auto it = postings.find(trigram);
+
+		if (it == postings.end())
+		{
+			out.clear();
+			return;
+		}
+
+		lists.push_back(&it->second);
+	}
+
+	// intersect starting from the rarest trigram, so the working set only shrinks
+	std::sort(lists.begin(), lists.end(), [](auto a, auto b) { return a->size() < b->size(); });
+
+	out.assign(lists.front()->begin(), lists.front()->end());
+
+	std::vector<std::uint32_t> intersection;
+	for (std::size_t i = 1; i < lists.size() && !out.empty(); i++)
+	{
+		intersection.clear();
+		std::set_intersection(
+			out.begin(), out.end(),
+			lists[i]->begin(), lists[i]->end(),
+			std::back_inserter(intersection)
+		);
+		out.swap(intersection);
+	}
+}
+
+bool NIDSearchIndex::containsTrigrams(const Query& query, const Entry& entry)
+{
+	for (std::size_t pos = 0; pos + 3 <= query.lowerQuery.size(); pos++)
+	{
+		const auto trigram = std::string_view{ query.lowerQuery }.substr(pos, 3);
+
+		if (
+			entry.lowerName.find(trigram) == std::string::npos &&
+			entry.idString.find(trigram) == std::string::npos
+		)
+			return false;
+	}
+
+	return true;
+}
+
+bool NIDSearchIndex::couldMatch(const Query& query, const Entry& entry)
+{
+	// a character of the query appears neither in the name nor in the ID
+	if ((query.charMask & ~entry.charMask) != 0)
+		return false;
+
+	return isSubsequence(query.lowerQuery, entry.lowerName) || isSubsequence(query.lowerQuery, entry.idString);
+}
+
+template <typename... Indices>
+bool NIDSearchIndex::matchesImpl(const Query& query, const Entry& entry, double& weighted, Indices&... indices)
+{
+	weighted = 0;
+
+	if ((query.charMask & ~entry.charMask) != 0)
+		return false;
+
+	const bool nameCanMatch = isSubsequence(query.lowerQuery, entry.lowerName);
+	const bool idCanMatch = isSubsequence(query.lowerQuery, entry.idString);
+
+	if (!nameCanMatch && !idCanMatch)
+		return false;
+
+	bool doesMatch = false;
+
+	if (nameCanMatch)
+		doesMatch |= ng::utils::fuzzy_match::weightedFuzzyMatch(entry.name, query.query, .5, weighted, indices...);
+	if (idCanMatch)
+		doesMatch |= ng::utils::fuzzy_match::weightedFuzzyMatch(entry.idString, query.query, 1.0, weighted);
+
+	return doesMatch && weighted >= query.threshold;
+}
+
+bool NIDSearchIndex::matches(const Query& query, const Entry& entry)
+{
+	double weighted;
+	return matchesImpl(query, entry, weighted);
+}
+
+bool NIDSearchIndex::matches(const Query& query, const Entry& entry, std::array<std::uint8_t, 256>& indices)
+{
+	double weighted;
+	return matchesImpl(query, entry, weighted, indices);
+}
+
+bool NIDSearchIndex::matches(const Query& query, const Entry& entry, double& weighted)
+{
+	return matchesImpl(query, entry, weighted);
+}
+
+
+const std::vector<std::uint32_t>& IncrementalSearch::search(std::shared_ptr<const NIDSearchIndex> index, std::string_view str)
+{
+	const NIDSearchIndex::Query query{ str };
+	const auto& entries = index->getEntries();
+	const bool useTrigrams = index->canUseTrigrams(query);
+
+	auto couldMatch = [&](std::uint32_t idx) {
+		return
+			NIDSearchIndex::couldMatch(query, entries[idx]) &&
+			(!useTrigrams || NIDSearchIndex::containsTrigrams(query, entries[idx]));
+	};
+
+	auto score = [&] {
+		m_results.clear();
+
+		auto& workerPool = WorkerPool::get();
+
+		if (m_candidates.size() < PARALLEL_SCORING_MIN_CANDIDATES || workerPool.getWorkerCount() == 0)
+		{
+			for (auto idx : m_candidates)
+				if (NIDSearchIndex::matches(query, entries[idx]))
+					m_results.push_back(idx);
+
+			return;
+		}
+
+		// not std::vector<bool>, chunks must not share bytes
+		std::vector<std::uint8_t> matched(m_candidates.size(), 0);
+
+		workerPool.run(
+			(m_candidates.size() + PARALLEL_SCORING_CHUNK_SIZE - 1) / PARALLEL_SCORING_CHUNK_SIZE,
+			[&](std::size_t chunk) {
+				const std::size_t begin = chunk * PARALLEL_SCORING_CHUNK_SIZE;
+				const std::size_t end = std::min(begin + PARALLEL_SCORING_CHUNK_SIZE, m_candidates.size());
+
+				for (std::size_t i = begin; i < end; i++)
+					matched[i] = NIDSearchIndex::matches(query, entries[m_candidates[i]]);
+			}
+		);
+
+		// candidates are in ID order, so are the results
+		for (std::size_t i = 0; i < m_candidates.size(); i++)
+			if (matched[i])
+				m_results.push_back(m_candidates[i]);
+	};
+
+	// the old query being a subsequence of the new one covers typing anywhere in it,
+	// otherwise characters were removed, or the index got rebuilt (or is of another NID)
+	const bool canNarrow =
+		index == m_index && !m_lower_query.empty() && isSubsequence(m_lower_query, query.lowerQuery) &&
+		// typing in the middle of the query breaks its trigrams apart, typing at the end only adds new ones
+		(!m_used_trigrams || (useTrigrams && query.lowerQuery.starts_with(m_lower_query)));
+
+	if (canNarrow)
+		std::erase_if(m_candidates, [&](std::uint32_t idx) { return !couldMatch(idx); });
+	else
+	{
+		m_index = std::move(index);
+
+		// rules out most of a big table before any string is looked at
+		if (useTrigrams)
+			m_index->filterByTrigrams(query, m_candidates);
+		else
+			m_index->filterByCharMask(query.charMask, m_candidates);
+
+		std::erase_if(m_candidates, [&](std::uint32_t idx) { return !couldMatch(idx); });
+	}
+
+	m_lower_query = query.lowerQuery;
+	m_used_trigrams = useTrigrams;
+
+	score();
+
+	// trigrams only find names containing the query as typed, fall back to fuzzy matching everything
+	// so typos and abbreviations still find something
+	if (useTrigrams && m_results.empty())
+	{
+		m_index->filterByCharMask(query.charMask, m_candidates);
+		std::erase_if(m_candidates, [&](std::uint32_t idx) { return !NIDSearchIndex::couldMatch(query, entries[idx]); });
+
+		m_used_trigrams = false;
+
+		score();
+	}
+
+	return m_results;
+}
+
+void IncrementalSearch::reset()
+{
+	m_index.reset();
+	m_lower_query.clear();
+	m_used_trigrams = false;
+	m_candidates.clear();
+	m_results.clear();
+}
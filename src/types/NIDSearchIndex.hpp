@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <NIDEnum.hpp>
+
+namespace ng::types
+{
+	/**
+	 * @brief Snapshot of the Named IDs of a NID, prepared for fuzzy searching.
+	 * Entries are sorted by ID. The snapshot is rebuilt when the NID's container generation changes,
+	 * until then every search reuses it.
+	 * The index of ng::constants::ALL_NIDS spans every NID, sorted by NID then ID.
+	 */
+	class NIDSearchIndex
+	{
+	public:
+		struct Entry
+		{
+			// original case is kept for scoring, fts gives a bonus to camelCase
+			std::string name;
+			std::string lowerName;
+			std::string idString;
+			// case folded characters of the name and ID string
+			std::uint64_t charMask;
+			NID nid;
+			short id;
+		};
+
+		// everything about a query that doesn't depend on the entry it's matched against
+		struct Query
+		{
+			explicit Query(std::string_view);
+
+			bool empty() const { return query.empty(); }
+
+			std::string query;
+			std::string lowerQuery;
+			std::uint64_t charMask;
+			double threshold;
+			// distinct, case folded
+			std::vector<std::uint32_t> trigrams;
+		};
+
+		// maps every (case folded) trigram of names and ID strings to the entries containing it
+		struct TrigramIndex
+		{
+			std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> postings;
+
+			std::size_t getMemoryUsage() const;
+		};
+
+		static std::shared_ptr<const NIDSearchIndex> get(NID);
+
+		NID getNID() const { return m_nid; }
+		std::uint32_t getGeneration() const { return m_generation; }
+		const std::vector<Entry>& getEntries() const { return m_entries; }
+		// index of the entry, binary searched
+		std::optional<std::uint32_t> find(NID, short) const;
+
+		// indices of the entries containing every character of the mask, in ID order
+		void filterByCharMask(std::uint64_t, std::vector<std::uint32_t>&) const;
+
+		// whether the query is long enough and the table big enough for the trigram index to be worth it
+		bool canUseTrigrams(const Query&) const;
+		// built on first use
+		const TrigramIndex& getTrigramIndex() const;
+		// indices of the entries containing every trigram of the query, in ID order
+		void filterByTrigrams(const Query&, std::vector<std::uint32_t>&) const;
+		static bool containsTrigrams(const Query&, const Entry&);
+
+		// cheap check without scoring, false means `matches` is false for this query and every query extending it
+		static bool couldMatch(const Query&, const Entry&);
+		// same results as ng::utils::fuzzy_match::matchesQuery
+		static bool matches(const Query&, const Entry&);
+		static bool matches(const Query&, const Entry&, std::array<std::uint8_t, 256>&);
+		// also outputs the weighted score, higher is better
+		static bool matches(const Query&, const Entry&, double&);
+
+		static std::uint64_t charMaskOf(std::string_view);
+
+	private:
+		NIDSearchIndex(NID, std::uint32_t);
+
+		template <typename... Indices>
+		static bool matchesImpl(const Query&, const Entry&, double&, Indices&...);
+
+	private:
+		NID m_nid;
+		std::uint32_t m_generation;
+		std::vector<Entry> m_entries;
+		// copy of every entry's charMask, kept contiguous so filterByCharMask can be vectorized
+		std::vector<std::uint64_t> m_char_masks;
+
+		mutable std::once_flag m_trigrams_built;
+		mutable std::unique_ptr<TrigramIndex> m_trigrams;
+	};
+
+	/**
+	 * @brief Searches an index keystroke by keystroke.
+	 * Entries that can't match a query can't match any query extending it either,
+	 * so when characters were only added to the query, only the previous candidates are looked at again.
+	 */
+	class IncrementalSearch
+	{
+	public:
+		// indices into the index' entries of the ones matching the query, in ID order
+		const std::vector<std::uint32_t>& search(std::shared_ptr<const NIDSearchIndex>, std::string_view);
+		void reset();
+
+	private:
+		std::shared_ptr<const NIDSearchIndex> m_index;
+		std::string m_lower_query;
+		// entries that could match m_lower_query, a superset of m_results
+		std::vector<std::uint32_t> m_candidates;
+		// whether m_candidates were also required to contain every trigram of m_lower_query
+		bool m_used_trigrams = false;
+		std::vector<std::uint32_t> m_results;
+	};
+}
@@ -0,0 +1,135 @@
+#include "RecyclingList.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace geode::prelude;
+using namespace ng::types;
+
+RecyclingList* RecyclingList::create(const CCSize& size, float rowHeight, CellFactory&& createCell, CellBinder&& bindCell)
+{
+	auto ret = new RecyclingList();
+
+	if (ret && ret->init(size, rowHeight, std::move(createCell), std::move(bindCell)))
+		ret->autorelease();
+	else
+	{
+		delete ret;
+		ret = nullptr;
+	}
+
+	return ret;
+}
+
+bool RecyclingList::init(const CCSize& size, float rowHeight, CellFactory&& createCell, CellBinder&& bindCell)
+{
+	if (!CCNode::init()) return false;
+
+	m_row_height = rowHeight;
+	m_bind_cell = std::move(bindCell);
+
+	this->setContentSize(size);
+
+	m_scroll_layer = ScrollLayer::create(size);
+	m_scroll_layer->m_contentLayer->setContentHeight(size.height);
+	this->addChild(m_scroll_layer);
+
+	const auto cellCount = static_cast<std::size_t>(std::ceil(size.height / rowHeight)) + 1 + OVERSCAN * 2;
+
+	m_cells.reserve(cellCount);
+	m_cell_rows.assign(cellCount, NO_ROW);
+
+	for (std::size_t i = 0; i < cellCount; i++)
+	{
+		auto cell = createCell();
+		if (!cell) return false;
+
+		cell->ignoreAnchorPointForPosition(false);
+		cell->setAnchorPoint({ .0f, .0f });
+		cell->setVisible(false);
+		m_scroll_layer->m_contentLayer->addChild(cell);
+		m_cells.push_back(cell);
+	}
+
+	this->scheduleUpdate();
+
+	return true;
+}
+
+void RecyclingList::setRowCount(std::size_t count)
+{
+	auto content = m_scroll_layer->m_contentLayer;
+	const float viewHeight = m_scroll_layer->getContentHeight();
+	const float scrolled = content->getContentHeight() + content->getPositionY() - viewHeight;
+
+	m_row_count = count;
+
+	const float contentHeight = std::max(viewHeight, m_row_height * count);
+	content->setContentHeight(contentHeight);
+	content->setPositionY(viewHeight - contentHeight + std::clamp(scrolled, .0f, contentHeight - viewHeight));
+
+	rebindAll();
+}
+
+void RecyclingList::rebindAll()
+{
+	updateCells(true);
+}
+
+void RecyclingList::moveToTop()
+{
+	auto content = m_scroll_layer->m_contentLayer;
+
+	content->setPositionY(m_scroll_layer->getContentHeight() - content->getContentHeight());
+
+	updateCells(false);
+}
+
+void RecyclingList::update(float)
+{
+	updateCells(false);
+}
+
+void RecyclingList::updateCells(bool force)
+{
+	auto content = m_scroll_layer->m_contentLayer;
+	const float contentY = content->getPositionY();
+
+	// nothing scrolled, every cell still shows the right row
+	if (!force && contentY == m_last_content_y) return;
+	m_last_content_y = contentY;
+
+	const float scrolled = std::max(content->getContentHeight() + contentY - m_scroll_layer->getContentHeight(), .0f);
+	const auto firstVisible = static_cast<std::size_t>(scrolled / m_row_height);
+	const auto first = firstVisible > OVERSCAN ? firstVisible - OVERSCAN : 0;
+
+	const auto cellCount = m_cells.size();
+
+	for (auto row = first; row < first + cellCount; row++)
+	{
+		const auto slot = row % cellCount;
+		auto cell = m_cells[slot];
+
+		if (row >= m_row_count)
+		{
+			// parked below the content, where the content layer's culling keeps it hidden
+			m_cell_rows[slot] = NO_ROW;
+			cell->setPositionY(-m_row_height * 2.f);
+			cell->setVisible(false);
+
+			continue;
+		}
+
+		if (!force && m_cell_rows[slot] == row) continue;
+
+		m_cell_rows[slot] = row;
+		m_bind_cell(cell, row);
+		cell->setPosition({ .0f, rowPositionY(row) });
+		cell->setVisible(true);
+	}
+}
+
+float RecyclingList::rowPositionY(std::size_t row) const
+{
+	return m_scroll_layer->m_contentLayer->getContentHeight() - m_row_height * (row + 1);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <Geode/cocos/base_nodes/CCNode.h>
+#include <Geode/ui/ScrollLayer.hpp>
+
+namespace ng::types
+{
+	/**
+	 * @brief Scrollable list of fixed height rows that only has cells for the rows on screen (and a few around them).
+	 * When scrolling, cells that leave the viewport are rebound to the rows entering it,
+	 * rows are positioned from their index instead of through a layout.
+	 */
+	class RecyclingList : public cocos2d::CCNode
+	{
+	public:
+		using CellFactory = std::function<cocos2d::CCNode*()>;
+		// binds the cell to the row with the given index
+		using CellBinder = std::function<void(cocos2d::CCNode*, std::size_t)>;
+
+		// rows kept bound above and below the viewport, so slow scrolling doesn't rebind every frame
+		static constexpr std::size_t OVERSCAN = 2;
+
+		static RecyclingList* create(const cocos2d::CCSize&, float, CellFactory&&, CellBinder&&);
+
+	protected:
+		bool init(const cocos2d::CCSize&, float, CellFactory&&, CellBinder&&);
+
+	public:
+		geode::ScrollLayer* getScrollLayer() const { return m_scroll_layer; }
+		const std::vector<cocos2d::CCNode*>& getCells() const { return m_cells; }
+
+		std::size_t getRowCount() const { return m_row_count; }
+		// keeps the scroll position as far as the new row count allows and binds every cell again
+		void setRowCount(std::size_t);
+		// binds every cell again, even the ones already bound to their row.
+		// The binder should skip cells that already show the row's data, so only changed rows cost anything
+		void rebindAll();
+
+		void moveToTop();
+
+		virtual void update(float) override;
+
+	private:
+		static constexpr std::size_t NO_ROW = std::numeric_limits<std::size_t>::max();
+
+		void updateCells(bool);
+		float rowPositionY(std::size_t) const;
+
+	private:
+		float m_row_height;
+		std::size_t m_row_count = 0;
+
+		CellBinder m_bind_cell;
+
+		geode::ScrollLayer* m_scroll_layer;
+		// cell i shows a row r with r % m_cells.size() == i
+		std::vector<cocos2d::CCNode*> m_cells;
+		std::vector<std::size_t> m_cell_rows;
+
+		float m_last_content_y = std::numeric_limits<float>::quiet_NaN();
+	};
+}
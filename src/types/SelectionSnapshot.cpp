@@ -0,0 +1,51 @@
+#include "SelectionSnapshot.hpp"
+
+using namespace ng::types;
+
+void SelectionSnapshot::clear()
+{
+	m_group_offsets.clear();
+	m_group_offsets.push_back(0);
+	m_groups.clear();
+
+	m_getters.clear();
+	m_value_offsets.clear();
+	m_value_offsets.push_back(0);
+	m_values.clear();
+}
+
+void SelectionSnapshot::capture(GameObject* obj)
+{
+	// every slot, removing a group leaves a hole instead of shifting the ones after it
+	if (obj->m_groups && obj->m_groupCount > 0)
+		m_groups.insert(m_groups.end(), obj->m_groups->begin(), obj->m_groups->end());
+	m_group_offsets.push_back(static_cast<std::uint32_t>(m_groups.size()));
+
+	const getters_t* getters = nullptr;
+
+	if (obj->m_classType == GameObjectClassType::Effect)
+	{
+		auto gettersIt = ng::constants::OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS.find(obj->m_objectID);
+
+		if (gettersIt != ng::constants::OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS.end())
+		{
+			getters = &gettersIt->second;
+
+			for (const auto& [nid, getter] : *getters)
+				if (nid != NID::_UNKNOWN)
+					m_values.push_back(getter(static_cast<EffectGameObject*>(obj)));
+		}
+	}
+	m_getters.push_back(getters);
+	m_value_offsets.push_back(static_cast<std::uint32_t>(m_values.size()));
+}
+
+std::span<const short> SelectionSnapshot::getGroups(std::size_t idx) const
+{
+	return std::span{ m_groups }.subspan(m_group_offsets[idx], m_group_offsets[idx + 1] - m_group_offsets[idx]);
+}
+
+std::span<const int> SelectionSnapshot::getValues(std::size_t idx) const
+{
+	return std::span{ m_values }.subspan(m_value_offsets[idx], m_value_offsets[idx + 1] - m_value_offsets[idx]);
+}
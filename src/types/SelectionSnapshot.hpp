@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <Geode/binding/GameObject.hpp>
+
+#include "constants.hpp"
+
+namespace ng::types
+{
+	/**
+	 * @brief The IDs of the selected objects before an editor action changes them, as flat arrays.
+	 * Objects with any group keep all 10 group slots (holes included), objects without one keep none.
+	 * The dynamic IDs are only kept for triggers in `ng::constants::OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS`,
+	 * in the order of their getters.
+	 * clear() keeps the capacity, so a reused snapshot stops allocating once it fits the selection.
+	*/
+	class SelectionSnapshot
+	{
+	public:
+		using getters_t = decltype(ng::constants::OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS)::mapped_type;
+
+		SelectionSnapshot() { clear(); }
+
+		void clear();
+		void capture(GameObject*);
+
+		std::size_t size() const { return m_getters.size(); }
+
+		// empty, or every slot of the object's m_groups in order
+		std::span<const short> getGroups(std::size_t idx) const;
+		// nullptr for objects without dynamic IDs
+		const getters_t* getGetters(std::size_t idx) const { return m_getters[idx]; }
+		// one value per getter that isn't an unused slot
+		std::span<const int> getValues(std::size_t idx) const;
+
+	private:
+		// object idx owns [offsets[idx], offsets[idx + 1])
+		std::vector<std::uint32_t> m_group_offsets;
+		std::vector<short> m_groups;
+
+		std::vector<const getters_t*> m_getters;
+		std::vector<std::uint32_t> m_value_offsets;
+		std::vector<int> m_values;
+	};
+}
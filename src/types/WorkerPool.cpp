@@ -0,0 +1,96 @@
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+using namespace ng::types;
+
+WorkerPool& WorkerPool::get()
+{
+	// never destroyed, joining threads while the mod is being unloaded can deadlock
+	static WorkerPool* instance = new WorkerPool(
+		std::clamp<std::size_t>(std::thread::hardware_concurrency(), 2, 8) - 1
+	);
+
+	return *instance;
+}
+
+WorkerPool::WorkerPool(std::size_t workerCount)
+{
+	m_workers.reserve(workerCount);
+
+	for (std::size_t i = 0; i < workerCount; i++)
+	{
+		m_workers.emplace_back(&WorkerPool::workerLoop, this);
+		m_workers.back().detach();
+	}
+}
+
+void WorkerPool::run(std::size_t chunks, const std::function<void(std::size_t)>& task)
+{
+	if (chunks == 0) return;
+
+	std::lock_guard runLock(m_run_mutex);
+
+	auto job = std::make_shared<Job>();
+	job->task = &task;
+	job->chunks = chunks;
+	job->remainingChunks = chunks;
+
+	{
+		std::lock_guard lock(m_mutex);
+
+		m_job = job;
+		m_job_count++;
+	}
+	m_job_cv.notify_all();
+
+	runChunks(*job);
+
+	std::unique_lock lock(m_mutex);
+	m_done_cv.wait(lock, [&] { return job->remainingChunks == 0; });
+
+	m_job.reset();
+}
+
+void WorkerPool::workerLoop()
+{
+	std::uint64_t lastJob = 0;
+
+	while (true)
+	{
+		std::shared_ptr<Job> job;
+
+		{
+			std::unique_lock lock(m_mutex);
+			m_job_cv.wait(lock, [&] { return m_job_count != lastJob; });
+
+			lastJob = m_job_count;
+			job = m_job;
+		}
+
+		if (job)
+			runChunks(*job);
+	}
+}
+
+void WorkerPool::runChunks(Job& job)
+{
+	std::size_t done = 0;
+
+	for (
+		std::size_t chunk = job.nextChunk.fetch_add(1);
+		chunk < job.chunks;
+		chunk = job.nextChunk.fetch_add(1)
+	) {
+		(*job.task)(chunk);
+		done++;
+	}
+
+	if (done == 0) return;
+
+	std::lock_guard lock(m_mutex);
+
+	job.remainingChunks -= done;
+	if (job.remainingChunks == 0)
+		m_done_cv.notify_all();
+}
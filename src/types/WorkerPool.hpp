@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ng::types
+{
+	/**
+	 * @brief A few threads to split CPU heavy work over.
+	 * The pool lives as long as the mod, its threads sleep while there's nothing to run.
+	 */
+	class WorkerPool
+	{
+	public:
+		static WorkerPool& get();
+
+		// not counting the thread calling run
+		std::size_t getWorkerCount() const { return m_workers.size(); }
+
+		// calls `task(chunk)` for every chunk in [0, chunks) and returns once all of them are done,
+		// the calling thread works on chunks too
+		void run(std::size_t chunks, const std::function<void(std::size_t)>& task);
+
+	private:
+		struct Job
+		{
+			const std::function<void(std::size_t)>* task;
+			std::size_t chunks;
+			std::atomic<std::size_t> nextChunk = 0;
+			std::size_t remainingChunks;
+		};
+
+		explicit WorkerPool(std::size_t);
+
+		void workerLoop();
+		void runChunks(Job&);
+
+	private:
+		std::vector<std::thread> m_workers;
+
+		// only one job at a time
+		std::mutex m_run_mutex;
+
+		std::mutex m_mutex;
+		std::condition_variable m_job_cv;
+		std::condition_variable m_done_cv;
+
+		// workers that wake up late keep their own reference, and find no chunks left in it
+		std::shared_ptr<Job> m_job;
+		std::uint64_t m_job_count = 0;
+	};
+}
@@ -7,7 +7,6 @@
 #include <NIDEnum.hpp>
 
 #include "DynamicPropertyTypes.hpp"
-#include "GameObjectData.hpp"
 #include "FastMap.hpp"
 
 namespace ng::constants
@@ -32,6 +31,12 @@ namespace ng::constants
 
 	inline constexpr std::uint16_t MAX_DESCRIPTION_LENGTH = 100;
 
+	// highest ID the editor allows, for every NID
+	inline constexpr short MAX_ID = 9999;
+
+	// stands for every NID at once, e.g. when searching
+	inline constexpr NID ALL_NIDS = NID::_UNKNOWN;
+
 	inline constexpr std::array TRIGGER_OBJECT_IDS_WITH_LABEL{
 		901u, 1616u, 1007u, 1049u,
 		1268u, 1346u, 2067u, 1347u,
@@ -1635,274 +1640,274 @@ namespace ng::constants
 	static_assert(DYNAMIC_PROPERTIES_CHOICES.unique());
 
 	// lord help me this game is unbearable
-	using data_getters_pair_t = std::pair<int&(*)(ng::types::GameObjectData&), int&(*)(EffectGameObject*)>;
-	using data_getters_map_t = fm::element<NID, data_getters_pair_t>;
+	using data_getter_t = int&(*)(EffectGameObject*);
+	using data_getters_map_t = fm::element<NID, data_getter_t>;
 
-#define FMAP_GETTER_PAIR fmap<NID, data_getters_pair_t, 6>
-#define MAKE_GETTER_PAIR(member) data_getters_pair_t{ +[](GameObjectData& o) -> int& { return o.member; }, +[](EffectGameObject* o) -> int& { return o->member; } }
+#define FMAP_GETTERS fmap<NID, data_getter_t, 6>
+#define MAKE_GETTER(member) +[](EffectGameObject* o) -> int& { return o->member; }
 
 	inline constexpr const auto OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS = fmap<std::uint16_t, fast_map<data_getters_map_t, 6>, 54>({
 		// Move Trigger
-		{ 901, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetModCenterID) }
+		{ 901, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_targetModCenterID) }
 		}) },
 		// Stop Trigger
-		{ 1616, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1616, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Pulse Trigger
-		{ 1006, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::COLOR, MAKE_GETTER_PAIR(m_copyColorID) }
+		{ 1006, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::COLOR, MAKE_GETTER(m_copyColorID) }
 		}) },
 		// Alpha Trigger
-		{ 1007, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1007, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Stop Trigger
-		{ 1049, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1049, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Spawn Trigger
-		{ 1268, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1268, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Rotate Trigger
-		{ 1346, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_rotationTargetID) }
+		{ 1346, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_rotationTargetID) }
 		}) },
 		// Scale Trigger
-		{ 2067, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 2067, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Follow Trigger
-		{ 1347, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 1347, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Animate Trigger
-		{ 1585, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1585, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Keyframe Trigger
-		{ 3033, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3033, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Follow Player Y Trigger
-		{ 1814, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1814, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Advanced Follow Trigger
-		{ 3016, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3016, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Edit Advanced Follow Trigger
-		{ 3660, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 3660, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Re-Target Advanced Follow Trigger
-		{ 3661, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3661, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Keyframe Trigger
-		{ 3032, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3032, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Area Move Trigger
-		{ 3006, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3006, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Area Rotate Trigger
-		{ 3007, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3007, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Area Scale Trigger
-		{ 3008, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3008, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Area Fade Trigger
-		{ 3009, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3009, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Area Tint Trigger
-		{ 3010, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3010, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Edit Area Move Trigger
-		{ 3011, FMAP_GETTER_PAIR({
+		{ 3011, FMAP_GETTERS({
 			// can also be Effect ID
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Edit Area Rotate Trigger
-		{ 3012, FMAP_GETTER_PAIR({
+		{ 3012, FMAP_GETTERS({
 			// can also be Effect ID
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Edit Area Scale Trigger
-		{ 3013, FMAP_GETTER_PAIR({
+		{ 3013, FMAP_GETTERS({
 			// can also be Effect ID
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Edit Area Fade Trigger
-		{ 3014, FMAP_GETTER_PAIR({
+		{ 3014, FMAP_GETTERS({
 			// can also be Effect ID
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Edit Area Tint Trigger
-		{ 3015, FMAP_GETTER_PAIR({
+		{ 3015, FMAP_GETTERS({
 			// can also be Effect ID
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Touch Trigger
-		{ 1595, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1595, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Count Trigger
-		{ 1611, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::COUNTER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 1611, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::COUNTER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Instant Count Trigger
-		{ 1811, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::COUNTER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 1811, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::COUNTER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Instant Count Trigger
-		{ 1817, FMAP_GETTER_PAIR({
-			{ NID::COUNTER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 1817, FMAP_GETTERS({
+			{ NID::COUNTER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Timer Trigger
-		{ 3614, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::TIMER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 3614, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::TIMER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Timer Event Trigger
-		{ 3615, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::TIMER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 3615, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::TIMER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Timer Control Trigger
-		{ 3617, FMAP_GETTER_PAIR({
-			{ NID::TIMER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 3617, FMAP_GETTERS({
+			{ NID::TIMER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Item Edit Trigger
-		{ 3619, FMAP_GETTER_PAIR({
-			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER_PAIR(m_itemID) },
-			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER_PAIR(m_itemID2) },
-			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 3619, FMAP_GETTERS({
+			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER(m_itemID) },
+			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER(m_itemID2) },
+			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Item Compare Trigger
-		{ 3620, FMAP_GETTER_PAIR({
-			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER_PAIR(m_itemID) },
-			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER_PAIR(m_itemID2) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3620, FMAP_GETTERS({
+			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER(m_itemID) },
+			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER(m_itemID2) },
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Persistent Item Trigger
-		{ 3641, FMAP_GETTER_PAIR({
-			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER_PAIR(m_itemID) }
+		{ 3641, FMAP_GETTERS({
+			{ NID::DYNAMIC_COUNTER_TIMER, MAKE_GETTER(m_itemID) }
 		}) },
 		// Random Trigger
-		{ 1912, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 1912, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Spawn Particle Trigger
-		{ 3608, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3608, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Reset Trigger
-		{ 3618, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 3618, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Static Camera Trigger
-		{ 1914, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 1914, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Edge Camera Trigger
-		{ 2062, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 2062, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Edit Song Trigger
-		{ 3605, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3605, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// SFX Trigger
-		{ 3602, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3602, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Edit SFX Trigger
-		{ 3603, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3603, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Event Trigger
-		{ 3604, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 3604, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// UI Object Trigger
-		{ 3613, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3613, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Visibility Link Trigger
-		{ 3662, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 3662, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// Collision Trigger
-		{ 1815, FMAP_GETTER_PAIR({
-			{ NID::COLLISION, MAKE_GETTER_PAIR(m_itemID) },
-			{ NID::COLLISION, MAKE_GETTER_PAIR(m_itemID2) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 1815, FMAP_GETTERS({
+			{ NID::COLLISION, MAKE_GETTER(m_itemID) },
+			{ NID::COLLISION, MAKE_GETTER(m_itemID2) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Instant Collision Trigger
-		{ 3609, FMAP_GETTER_PAIR({
-			{ NID::COLLISION, MAKE_GETTER_PAIR(m_itemID) },
-			{ NID::COLLISION, MAKE_GETTER_PAIR(m_itemID2) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3609, FMAP_GETTERS({
+			{ NID::COLLISION, MAKE_GETTER(m_itemID) },
+			{ NID::COLLISION, MAKE_GETTER(m_itemID2) },
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Collision State Trigger
-		{ 3640, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3640, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Collision Block
-		{ 1816, FMAP_GETTER_PAIR({
-			{ NID::COLLISION, MAKE_GETTER_PAIR(m_itemID) }
+		{ 1816, FMAP_GETTERS({
+			{ NID::COLLISION, MAKE_GETTER(m_itemID) }
 		}) },
 		// On Death Trigger
-		{ 1812, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 1812, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) },
 		// End Trigger
-		{ 3600, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) },
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_centerGroupID) }
+		{ 3600, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) },
+			{ NID::GROUP, MAKE_GETTER(m_centerGroupID) }
 		}) },
 		// Teleport Trigger
-		{ 3622, FMAP_GETTER_PAIR({
-			{ NID::GROUP, MAKE_GETTER_PAIR(m_targetGroupID) }
+		{ 3622, FMAP_GETTERS({
+			{ NID::GROUP, MAKE_GETTER(m_targetGroupID) }
 		}) }
 	});
 	static_assert(OBJECT_ID_TO_DYNAMIC_GROUPS_GETTERS.unique());
-#undef FMAP_GETTER_PAIR
-#undef MAKE_GETTER_PAIR
+#undef FMAP_GETTERS
+#undef MAKE_GETTER
 }
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
+#include "IDFormatParser.hpp"
+
 namespace ng::globals
 {
 	inline bool g_isEditorIDAPILoaded = false;
@@ -9,5 +12,16 @@ namespace ng::globals
 	// inline bool g_isImprovedGroupViewLoaded = false;
 
 	inline std::string g_buildHelperRawNameFormat = "";
-	inline std::string g_buildHelperNameFormat = "";
+	// compiled from g_buildHelperRawNameFormat whenever the setting changes, empty if it didn't parse
+	inline ng::parser::NameFormat g_buildHelperNameFormat;
+	inline std::string g_buildHelperNameFormatError = "";
+
+	// milliseconds spent refreshing object labels per frame
+	inline double g_labelRefreshBudget = 2.0;
+	// object labels are hidden below this editor zoom level
+	inline double g_labelLODZoom = .4;
+
+	inline bool g_useTrigramSearch = true;
+	// Named ID tables smaller than this are always fuzzy matched entry by entry
+	inline std::int64_t g_trigramSearchMinSize = 2000;
 }
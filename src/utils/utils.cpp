@@ -14,6 +14,7 @@
 
 // #include "globals.hpp"
 #include "constants.hpp"
+#include "LabelRefreshScheduler.hpp"
 
 geode::Result<> ng::utils::sanitizeName(const std::string_view name)
 {
@@ -87,16 +88,8 @@ cocos2d::CCNode* ng::utils::cocos::getChildByPredicate(cocos2d::CCNode* parent,
 
 void ng::utils::editor::refreshObjectLabels()
 {
-	if (const auto lel = LevelEditorLayer::get())
-	{
-		for (auto trigger : lel->m_activeObjects)
-		{
-			// trigger can be nullptr for some fucking reason
-			// 1816 is player object, which has a hidden object label
-			if (!trigger || trigger->m_objectID == 1816u) continue;
-			lel->updateObjectLabel(trigger);
-		}
-	}
+	// updating every label at once freezes the game on big levels
+	ng::types::LabelRefreshScheduler::get()->queueAll();
 }
 
 void ng::utils::editor::postIGVUpdateEvent()